@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef ARRAY_BENCH_HPP
+#define ARRAY_BENCH_HPP
+
+#include "../benchmark.hpp"
+#include "riot/array.hpp"
+
+// Benchmark copy assignment, fill() and operator == of an Array<BenchBlob<Bytes>, Capacity>.
+// One operation processes the whole Array.
+template <std::size_t Bytes, std::size_t Capacity>
+auto arrayBench() -> void
+{
+    typedef BenchBlob<Bytes> Blob;
+    static riot::Array<Blob, Capacity> a;
+    static riot::Array<Blob, Capacity> b;
+    Blob blob;
+    uint32_t ops = BenchOps / Capacity;
+    BenchStopwatch sw;
+
+    sw.start();
+    for (uint32_t i = 0; i < ops; ++i) {
+        b = a;
+        riot::doNotOptimize(b);
+    }
+    sw.stop();
+    benchReport("array.copy", Bytes, Capacity, ops, sw);
+
+    sw.start();
+    for (uint32_t i = 0; i < ops; ++i) {
+        a.fill(blob);
+        riot::doNotOptimize(a);
+    }
+    sw.stop();
+    benchReport("array.fill", Bytes, Capacity, ops, sw);
+
+    sw.start();
+    for (uint32_t i = 0; i < ops; ++i) {
+        bool equal = (a == b);
+        riot::doNotOptimize(equal);
+    }
+    sw.stop();
+    benchReport("array.compare", Bytes, Capacity, ops, sw);
+}
+
+// Run Array benchmarks for all element sizes and capacities.
+auto runArrayBenchmarks() -> void
+{
+    arrayBench<1, 16>();
+    arrayBench<1, 256>();
+    arrayBench<4, 16>();
+    arrayBench<4, 256>();
+    arrayBench<16, 16>();
+    arrayBench<16, 256>();
+    arrayBench<64, 16>();
+    arrayBench<64, 256>();
+}
+
+#endif // ARRAY_BENCH_HPP
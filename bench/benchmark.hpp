@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include "xtimer.h"
+#include "riot/bench.hpp"
+
+// Number of operations measured per benchmark.
+static uint32_t const BenchOps = 1UL << 16;
+
+// Element of configurable size, used to vary the element size of containers.
+template <std::size_t Bytes>
+class BenchBlob
+{
+public:
+    BenchBlob()
+    {
+        memset(this->data, 0, Bytes);
+    }
+
+    uint8_t data[Bytes];
+};
+
+template <std::size_t Bytes>
+auto operator == (BenchBlob<Bytes> const & lhs, BenchBlob<Bytes> const & rhs) -> bool
+{
+    return memcmp(lhs.data, rhs.data, Bytes) == 0;
+}
+
+// Measures elapsed time and cycles of a code section.
+class BenchStopwatch
+{
+public:
+    auto start() -> void
+    {
+        this->usec_ = xtimer_now_usec64();
+        this->start_ = riot::CycleCounter::now();
+    }
+
+    auto stop() -> void
+    {
+        this->cycles_ = riot::CycleCounter::elapsed(this->start_, riot::CycleCounter::now());
+        this->usec_ = xtimer_now_usec64() - this->usec_;
+    }
+
+    auto usec() const -> uint64_t
+    {
+        return this->usec_;
+    }
+
+    auto cycles() const -> uint64_t
+    {
+        return this->cycles_;
+    }
+
+private:
+    uint64_t usec_;
+    uint64_t cycles_;
+    riot::CycleCounter::Ticks start_;
+};
+
+// Start a CSV table. Every table in the output starts with a '# table,<name>'
+// line followed by its own header, so that the tables can be split apart.
+inline auto benchPrintTable(char const * name) -> void
+{
+    printf("# table,%s\n", name);
+}
+
+// Print CSV header and build information. Enables the cycle counter.
+// The cycles_per_op column is given in the unit of the counter.
+inline auto benchPrintHeader() -> void
+{
+    riot::CycleCounter::init();
+#ifdef RIOT_BOARD
+    printf("# board,%s\n", RIOT_BOARD);
+#endif
+#ifdef RIOT_VERSION
+    printf("# riot,%s\n", RIOT_VERSION);
+#endif
+    printf("# counter,%s\n", riot::CycleCounter::unit());
+    benchPrintTable("ops");
+    printf("benchmark,element_bytes,capacity,ops,ns_per_op,cycles_per_op\n");
+}
+
+// Print a result line. @p usec and @p cycles are totals over @p ops operations.
+inline auto benchReport(char const * name, std::size_t elementBytes, std::size_t capacity,
+                        uint32_t ops, uint64_t usec, uint64_t cycles) -> void
+{
+    uint64_t psPerOp = (usec * 1000000ULL) / ops;
+    printf("%s,%lu,%lu,%lu,%lu.%03lu,%lu\n", name,
+           static_cast<unsigned long>(elementBytes),
+           static_cast<unsigned long>(capacity),
+           static_cast<unsigned long>(ops),
+           static_cast<unsigned long>(psPerOp / 1000),
+           static_cast<unsigned long>(psPerOp % 1000),
+           static_cast<unsigned long>(cycles / ops));
+}
+
+// Print a result line of a single stopwatch measurement.
+inline auto benchReport(char const * name, std::size_t elementBytes, std::size_t capacity,
+                        uint32_t ops, BenchStopwatch const & sw) -> void
+{
+    benchReport(name, elementBytes, capacity, ops, sw.usec(), sw.cycles());
+}
+
+// Print a result line of the difference of two stopwatch measurements.
+// Used for operations that can only be measured together with a setup step.
+inline auto benchReportDiff(char const * name, std::size_t elementBytes, std::size_t capacity,
+                            uint32_t ops, BenchStopwatch const & total,
+                            BenchStopwatch const & setup) -> void
+{
+    uint64_t usec = (total.usec() > setup.usec()) ? total.usec() - setup.usec() : 0;
+    uint64_t cycles = (total.cycles() > setup.cycles()) ? total.cycles() - setup.cycles() : 0;
+    benchReport(name, elementBytes, capacity, ops, usec, cycles);
+}
+
+#endif // BENCHMARK_HPP
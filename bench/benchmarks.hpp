@@ -0,0 +1,32 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BENCHMARKS_HPP
+#define BENCHMARKS_HPP
+
+#include "benchmark.hpp"
+#include "ringbuffer/ringbuffer_bench.hpp"
+#include "ringbuffer/producerconsumer_bench.hpp"
+#include "array/array_bench.hpp"
+#include "mutex/mutex_bench.hpp"
+#include "semaphore/semaphore_bench.hpp"
+#include "containers/containers_bench.hpp"
+
+// Run all Benchmarks. Results are printed as CSV.
+auto runAllBenchmarks() -> void
+{
+    benchPrintHeader();
+    runRingbufferBenchmarks();
+    runArrayBenchmarks();
+    runMutexBenchmarks();
+    runSemaphoreBenchmarks();
+    runContainersBenchmarks();
+    runProducerConsumerBenchmarks();
+}
+
+#endif // BENCHMARKS_HPP
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef CONTAINERS_BENCH_HPP
+#define CONTAINERS_BENCH_HPP
+
+#include "riot/bench.hpp"
+#include "riot/hashmap.hpp"
+#include "riot/priorityqueue.hpp"
+#include "riot/bitset.hpp"
+
+// Benchmark insert() + erase() of a StaticHashMap filled to half capacity.
+auto containersBenchHashMap(void * arg, uint32_t iterations) -> void
+{
+    typedef riot::StaticHashMap<uint32_t, uint32_t, 64> Map;
+    Map & map = *static_cast<Map *>(arg);
+    for (uint32_t i = 0; i < iterations; ++i) {
+        map.insert(1000, i);
+        map.erase(1000);
+        riot::doNotOptimize(map);
+    }
+}
+
+// Benchmark push() + pop() of a PriorityQueue filled to half capacity.
+auto containersBenchPriorityQueue(void * arg, uint32_t iterations) -> void
+{
+    typedef riot::PriorityQueue<uint32_t, 64> Queue;
+    Queue & queue = *static_cast<Queue *>(arg);
+    uint32_t value;
+    for (uint32_t i = 0; i < iterations; ++i) {
+        queue.push(i & 63);
+        queue.pop(value);
+        riot::doNotOptimize(value);
+    }
+}
+
+// Benchmark findFirst() of a Bitset with only the last bit set.
+auto containersBenchBitset(void * arg, uint32_t iterations) -> void
+{
+    typedef riot::Bitset<256> Bits;
+    Bits & bits = *static_cast<Bits *>(arg);
+    for (uint32_t i = 0; i < iterations; ++i) {
+        std::size_t pos = bits.findFirst();
+        riot::doNotOptimize(pos);
+    }
+}
+
+// Run container benchmarks with riot::BenchSuite. Prints CSV with its own header.
+auto runContainersBenchmarks() -> void
+{
+    static riot::StaticHashMap<uint32_t, uint32_t, 64> map;
+    static riot::PriorityQueue<uint32_t, 64> queue;
+    static riot::Bitset<256> bits;
+    for (uint32_t i = 0; i < 32; ++i) {
+        map.insert(i, i);
+        queue.push(i * 2);
+    }
+    bits.set(255);
+
+    riot::BenchSuite<3> suite;
+    suite.add("statichashmap.insertErase", containersBenchHashMap, &map);
+    suite.add("priorityqueue.pushPop", containersBenchPriorityQueue, &queue);
+    suite.add("bitset.findFirst", containersBenchBitset, &bits);
+    benchPrintTable("suite");
+    suite.runAll();
+}
+
+#endif // CONTAINERS_BENCH_HPP
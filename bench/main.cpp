@@ -0,0 +1,19 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include "benchmarks.hpp"
+
+auto main(void) -> int
+{
+    runAllBenchmarks();
+    // Terminate the native process, the output is complete.
+    exit(0);
+    return 0;
+}
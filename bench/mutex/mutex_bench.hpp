@@ -0,0 +1,50 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef MUTEX_BENCH_HPP
+#define MUTEX_BENCH_HPP
+
+#include "../benchmark.hpp"
+#include "riot/mutex.hpp"
+
+// Benchmark an uncontended lock() + unlock() pair of Mutex.
+auto mutexBenchLockUnlock() -> void
+{
+    riot::Mutex m;
+    BenchStopwatch sw;
+    sw.start();
+    for (uint32_t i = 0; i < BenchOps; ++i) {
+        m.lock();
+        m.unlock();
+    }
+    sw.stop();
+    benchReport("mutex.lockUnlock", 0, 0, BenchOps, sw);
+}
+
+// Benchmark an uncontended LockGuard<Mutex> scope. The difference to
+// mutex.lockUnlock is the overhead of LockGuard.
+auto mutexBenchLockGuard() -> void
+{
+    riot::Mutex m;
+    BenchStopwatch sw;
+    sw.start();
+    for (uint32_t i = 0; i < BenchOps; ++i) {
+        riot::LockGuard<riot::Mutex> guard(m);
+    }
+    sw.stop();
+    benchReport("lockguard.scope", 0, 0, BenchOps, sw);
+}
+
+// Run Mutex and LockGuard benchmarks.
+auto runMutexBenchmarks() -> void
+{
+    mutexBenchLockUnlock();
+    mutexBenchLockGuard();
+}
+
+#endif // MUTEX_BENCH_HPP
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef PRODUCERCONSUMER_BENCH_HPP
+#define PRODUCERCONSUMER_BENCH_HPP
+
+#include "thread.h"
+#include "../benchmark.hpp"
+#include "riot/mutex.hpp"
+#include "riot/mutex/lockdummy_impl.hpp"
+#include "riot/semaphore.hpp"
+#include "riot/ringbuffer.hpp"
+#include "riot/histogram.hpp"
+
+// Limits of the producer/consumer benchmark.
+static std::size_t const PcBenchMaxProducers = 4;
+static std::size_t const PcBenchMaxConsumers = 4;
+static uint32_t const PcBenchMessages = 4096;
+static uint32_t const PcBenchPollUsec = 10;
+
+// Latency histogram: 6% resolution, values up to 2^20 usec get own buckets.
+typedef riot::Histogram<288, 4> PcBenchHistogram;
+
+// Thread setup of a single benchmark run.
+class PcBenchScenario
+{
+public:
+    std::size_t producers;
+    std::size_t consumers;
+    uint8_t producerPrio;
+    uint8_t consumerPrio;
+};
+
+// Scenarios: Thread counts and priorities relative to the main thread.
+static PcBenchScenario const PcBenchScenarios[] = {
+    {1, 1, THREAD_PRIORITY_MAIN - 1, THREAD_PRIORITY_MAIN - 1},
+    {1, 1, THREAD_PRIORITY_MAIN - 2, THREAD_PRIORITY_MAIN - 1},
+    {1, 1, THREAD_PRIORITY_MAIN - 1, THREAD_PRIORITY_MAIN - 2},
+    {2, 2, THREAD_PRIORITY_MAIN - 1, THREAD_PRIORITY_MAIN - 1},
+    {4, 1, THREAD_PRIORITY_MAIN - 1, THREAD_PRIORITY_MAIN - 1},
+    {1, 4, THREAD_PRIORITY_MAIN - 1, THREAD_PRIORITY_MAIN - 1},
+};
+
+// Message passed through the queues. Carries its enqueue time.
+class PcBenchMsg
+{
+public:
+    uint32_t stamp;
+    uint32_t stop;
+};
+
+// Unified blocking put/get on the benchmarked queue types.
+template <typename Queue>
+class PcBenchQueueOps;
+
+template <typename T, std::size_t Size, typename Buffer, typename Lock, typename Sema,
+          typename Trace, typename Wake>
+class PcBenchQueueOps<riot::BlockingRingbuffer<T, Size, Buffer, Lock, Sema, Trace, Wake> >
+{
+public:
+    typedef riot::BlockingRingbuffer<T, Size, Buffer, Lock, Sema, Trace, Wake> Queue;
+
+    static auto put(Queue & q, T const & msg) -> void
+    {
+        q.add(msg);
+    }
+
+    static auto get(Queue & q, T & msg) -> void
+    {
+        q.get(msg);
+    }
+};
+
+// LockedRingbuffer does not block: Poll with a short sleep, so that
+// lower priority threads can run.
+template <typename T, std::size_t Size, typename Buffer, typename Lock>
+class PcBenchQueueOps<riot::LockedRingbuffer<T, Size, Buffer, Lock> >
+{
+public:
+    typedef riot::LockedRingbuffer<T, Size, Buffer, Lock> Queue;
+
+    static auto put(Queue & q, T const & msg) -> void
+    {
+        while (q.putOne(msg) != 0) {
+            xtimer_usleep(PcBenchPollUsec);
+        }
+    }
+
+    static auto get(Queue & q, T & msg) -> void
+    {
+        while (q.getOne(msg) != 0) {
+            xtimer_usleep(PcBenchPollUsec);
+        }
+    }
+};
+
+// State shared between main thread, producers and consumers of one queue type.
+template <typename Queue>
+class PcBenchContext
+{
+public:
+    PcBenchContext()
+        : start(0)
+        , producersDone(0)
+        , consumersDone(0)
+        , messagesPerProducer(0)
+        , consumerIds(0)
+    {
+    }
+
+    Queue queue;
+    riot::Semaphore start;
+    riot::Semaphore producersDone;
+    riot::Semaphore consumersDone;
+    uint32_t messagesPerProducer;
+    uint32_t consumerIds;
+    PcBenchHistogram latencies[PcBenchMaxConsumers];
+};
+
+template <typename Queue>
+auto pcBenchProducer(void * arg) -> void *
+{
+    PcBenchContext<Queue> * ctx = static_cast<PcBenchContext<Queue> *>(arg);
+    ctx->start.wait();
+    PcBenchMsg msg;
+    msg.stop = 0;
+    for (uint32_t i = 0; i < ctx->messagesPerProducer; ++i) {
+        msg.stamp = xtimer_now_usec();
+        PcBenchQueueOps<Queue>::put(ctx->queue, msg);
+    }
+    ctx->producersDone.post();
+    return nullptr;
+}
+
+template <typename Queue>
+auto pcBenchConsumer(void * arg) -> void *
+{
+    PcBenchContext<Queue> * ctx = static_cast<PcBenchContext<Queue> *>(arg);
+    uint32_t id = __atomic_fetch_add(&(ctx->consumerIds), 1, __ATOMIC_RELAXED);
+    PcBenchHistogram & latencies = ctx->latencies[id];
+    ctx->start.wait();
+    PcBenchMsg msg = {0, 0};
+    for (;;) {
+        PcBenchQueueOps<Queue>::get(ctx->queue, msg);
+        if (msg.stop) {
+            break;
+        }
+        latencies.record(xtimer_now_usec() - msg.stamp);
+    }
+    ctx->consumersDone.post();
+    return nullptr;
+}
+
+// Wait until thread @p pid terminated, its stack can be reused afterwards.
+inline auto pcBenchJoin(kernel_pid_t pid) -> void
+{
+    while (thread_getstatus(pid) != STATUS_NOT_FOUND) {
+        xtimer_usleep(PcBenchPollUsec);
+    }
+}
+
+// Run one scenario on @p Queue and print a result line.
+template <typename Queue>
+auto pcBenchRun(char const * name, std::size_t depth, PcBenchScenario const & scenario) -> void
+{
+    static PcBenchContext<Queue> ctx;
+    static char stacks[PcBenchMaxProducers + PcBenchMaxConsumers][THREAD_STACKSIZE_DEFAULT];
+    kernel_pid_t pids[PcBenchMaxProducers + PcBenchMaxConsumers];
+    std::size_t threads = scenario.producers + scenario.consumers;
+
+    ctx.messagesPerProducer = PcBenchMessages / scenario.producers;
+    ctx.consumerIds = 0;
+    for (std::size_t i = 0; i < PcBenchMaxConsumers; ++i) {
+        ctx.latencies[i].reset();
+    }
+    for (std::size_t i = 0; i < threads; ++i) {
+        bool producer = i < scenario.producers;
+        pids[i] = thread_create(stacks[i], sizeof(stacks[i]),
+                                producer ? scenario.producerPrio : scenario.consumerPrio,
+                                THREAD_CREATE_STACKTEST,
+                                producer ? pcBenchProducer<Queue> : pcBenchConsumer<Queue>,
+                                &ctx, producer ? "producer" : "consumer");
+    }
+
+    // Release all threads at once and wait for the producers.
+    BenchStopwatch sw;
+    sw.start();
+    for (std::size_t i = 0; i < threads; ++i) {
+        ctx.start.post();
+    }
+    for (std::size_t i = 0; i < scenario.producers; ++i) {
+        ctx.producersDone.wait();
+    }
+
+    // Stop consumers with one stop message each.
+    PcBenchMsg stop;
+    stop.stamp = 0;
+    stop.stop = 1;
+    for (std::size_t i = 0; i < scenario.consumers; ++i) {
+        PcBenchQueueOps<Queue>::put(ctx.queue, stop);
+    }
+    for (std::size_t i = 0; i < scenario.consumers; ++i) {
+        ctx.consumersDone.wait();
+    }
+    sw.stop();
+    for (std::size_t i = 0; i < threads; ++i) {
+        pcBenchJoin(pids[i]);
+    }
+
+    // Merge per consumer latencies.
+    PcBenchHistogram & latencies = ctx.latencies[0];
+    for (std::size_t i = 1; i < scenario.consumers; ++i) {
+        latencies.merge(ctx.latencies[i]);
+    }
+    uint64_t n = latencies.samples();
+    uint64_t usec = (sw.usec() > 0) ? sw.usec() : 1;
+    printf("%s,%lu,%lu,%lu,%u,%u,%lu,%lu,%lu,%lu,%lu\n", name,
+           static_cast<unsigned long>(depth),
+           static_cast<unsigned long>(scenario.producers),
+           static_cast<unsigned long>(scenario.consumers),
+           scenario.producerPrio, scenario.consumerPrio,
+           static_cast<unsigned long>(n),
+           static_cast<unsigned long>((n * 1000000ULL) / usec),
+           static_cast<unsigned long>(latencies.quantile(500)),
+           static_cast<unsigned long>(latencies.quantile(990)),
+           static_cast<unsigned long>(latencies.max()));
+}
+
+// Run all scenarios on @p Queue.
+template <typename Queue>
+auto pcBenchQueue(char const * name, std::size_t depth) -> void
+{
+    for (std::size_t i = 0; i < sizeof(PcBenchScenarios) / sizeof(PcBenchScenarios[0]); ++i) {
+        pcBenchRun<Queue>(name, depth, PcBenchScenarios[i]);
+    }
+}
+
+// Run all queue types with queue depth @p Depth.
+template <std::size_t Depth>
+auto pcBenchDepth() -> void
+{
+    typedef riot::Ringbuffer<PcBenchMsg, Depth> Plain;
+    typedef riot::LockedRingbuffer<PcBenchMsg, Depth> Locked;
+    typedef riot::WakeCoalesced<(Depth > 1) ? Depth / 2 : 1, 1000> Coalesced;
+
+    pcBenchQueue<riot::BlockingRingbuffer<PcBenchMsg, Depth> >(
+        "blocking.ringbuffer.mutex", Depth);
+    pcBenchQueue<riot::BlockingRingbuffer<PcBenchMsg, Depth, Plain, riot::Mutex,
+                                          riot::WatchableSemaphore> >(
+        "blocking.ringbuffer.watchable", Depth);
+    pcBenchQueue<riot::BlockingRingbuffer<PcBenchMsg, Depth, Plain, riot::Mutex, riot::Semaphore,
+                                          riot::NoLatencyTrace, Coalesced> >(
+        "blocking.ringbuffer.coalesced", Depth);
+    pcBenchQueue<riot::BlockingRingbuffer<PcBenchMsg, Depth, Locked, riot::keepout::LockDummy> >(
+        "blocking.lockedringbuffer.dummy", Depth);
+    pcBenchQueue<riot::LockedRingbuffer<PcBenchMsg, Depth, Plain, riot::Mutex> >(
+        "locked.ringbuffer.mutex", Depth);
+}
+
+// Run producer/consumer benchmarks. Prints CSV with its own header.
+auto runProducerConsumerBenchmarks() -> void
+{
+    benchPrintTable("producer_consumer");
+    printf("queue,depth,producers,consumers,producer_prio,consumer_prio,"
+           "messages,msgs_per_sec,p50_us,p99_us,max_us\n");
+    pcBenchDepth<1>();
+    pcBenchDepth<8>();
+    pcBenchDepth<64>();
+}
+
+#endif // PRODUCERCONSUMER_BENCH_HPP
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef RINGBUFFER_BENCH_HPP
+#define RINGBUFFER_BENCH_HPP
+
+#include "../benchmark.hpp"
+#include "riot/ringbuffer.hpp"
+
+// Benchmark putOne(), getOne(), add() and get() of a Ringbuffer<BenchBlob<Bytes>, Capacity>.
+// getOne() and get() can only be measured after filling the buffer. Their cost
+// is the difference between fill + get and fill + remove().
+template <std::size_t Bytes, std::size_t Capacity>
+auto ringbufferBench() -> void
+{
+    typedef BenchBlob<Bytes> Blob;
+    static riot::Ringbuffer<Blob, Capacity> rbuf;
+    static Blob blobs[Capacity];
+    uint32_t rounds = BenchOps / Capacity;
+    uint32_t ops = rounds * Capacity;
+    BenchStopwatch setup;
+    BenchStopwatch total;
+
+    // putOne(): Fill the buffer element by element, then drop all elements.
+    setup.start();
+    for (uint32_t r = 0; r < rounds; ++r) {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            rbuf.putOne(blobs[i]);
+        }
+        rbuf.remove(Capacity);
+    }
+    setup.stop();
+    benchReport("ringbuffer.putOne", Bytes, Capacity, ops, setup);
+
+    // getOne(): Fill the buffer element by element, then drain it element by element.
+    total.start();
+    for (uint32_t r = 0; r < rounds; ++r) {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            rbuf.putOne(blobs[i]);
+        }
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            rbuf.getOne(blobs[i]);
+        }
+    }
+    total.stop();
+    benchReportDiff("ringbuffer.getOne", Bytes, Capacity, ops, total, setup);
+
+    // add(): Fill the buffer in one call, then drop all elements.
+    setup.start();
+    for (uint32_t r = 0; r < rounds; ++r) {
+        rbuf.add(blobs, Capacity);
+        rbuf.remove(Capacity);
+    }
+    setup.stop();
+    benchReport("ringbuffer.add", Bytes, Capacity, ops, setup);
+
+    // get(): Fill the buffer in one call, then drain it in one call.
+    total.start();
+    for (uint32_t r = 0; r < rounds; ++r) {
+        rbuf.add(blobs, Capacity);
+        rbuf.get(blobs, Capacity);
+    }
+    total.stop();
+    benchReportDiff("ringbuffer.get", Bytes, Capacity, ops, total, setup);
+    riot::doNotOptimize(blobs);
+}
+
+// Benchmark write() and read() of a byte Ringbuffer<uint8_t, Capacity> with
+// chunks of Chunk bytes. One operation transfers one byte. The offset of the
+// chunks moves, so that chunks wrap around the end of the storage.
+template <std::size_t Chunk, std::size_t Capacity>
+auto ringbufferBenchStream() -> void
+{
+    static riot::Ringbuffer<uint8_t, Capacity> rbuf;
+    static uint8_t chunk[Chunk];
+    uint32_t rounds = BenchOps / Chunk;
+    uint32_t ops = rounds * Chunk;
+    BenchStopwatch setup;
+    BenchStopwatch total;
+
+    rbuf.write(chunk, Capacity / 3);
+    setup.start();
+    for (uint32_t r = 0; r < rounds; ++r) {
+        rbuf.write(chunk, Chunk);
+        rbuf.skip(Chunk);
+    }
+    setup.stop();
+    benchReport("ringbuffer.write", 1, Capacity, ops, setup);
+
+    total.start();
+    for (uint32_t r = 0; r < rounds; ++r) {
+        rbuf.write(chunk, Chunk);
+        rbuf.read(chunk, Chunk);
+    }
+    total.stop();
+    benchReportDiff("ringbuffer.read", 1, Capacity, ops, total, setup);
+    riot::doNotOptimize(chunk);
+}
+
+// Run Ringbuffer benchmarks for all element sizes and capacities.
+auto runRingbufferBenchmarks() -> void
+{
+    ringbufferBench<1, 16>();
+    ringbufferBench<1, 256>();
+    ringbufferBench<4, 16>();
+    ringbufferBench<4, 256>();
+    ringbufferBench<16, 16>();
+    ringbufferBench<16, 256>();
+    ringbufferBench<64, 16>();
+    ringbufferBench<64, 256>();
+    ringbufferBenchStream<64, 256>();
+}
+
+#endif // RINGBUFFER_BENCH_HPP
@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef SEMAPHORE_BENCH_HPP
+#define SEMAPHORE_BENCH_HPP
+
+#include "../benchmark.hpp"
+#include "riot/semaphore.hpp"
+
+// Benchmark a non-blocking post() + wait() pair of Semaphore.
+auto semaphoreBenchPostWait() -> void
+{
+    riot::Semaphore s(0);
+    BenchStopwatch sw;
+    sw.start();
+    for (uint32_t i = 0; i < BenchOps; ++i) {
+        s.post();
+        s.wait();
+    }
+    sw.stop();
+    benchReport("semaphore.postWait", 0, 0, BenchOps, sw);
+}
+
+// Run Semaphore benchmarks.
+auto runSemaphoreBenchmarks() -> void
+{
+    semaphoreBenchPostWait();
+}
+
+#endif // SEMAPHORE_BENCH_HPP
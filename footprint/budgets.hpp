@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BUDGETS_HPP
+#define BUDGETS_HPP
+
+#include <cstddef>
+
+// RAM budgets in bytes. A budget limits the per-instance overhead of a
+// container, that is sizeof(container) minus the storage of its elements.
+// Defaults are the cost on 32-bit RIOT targets. Override with
+// FOOTPRINT_BUDGETS="-DFOOTPRINT_BUDGET_<NAME>=<bytes> ..." on make invocation.
+
+// Ringbuffer: Read index and fill level, padded to the element alignment.
+#ifndef FOOTPRINT_BUDGET_RINGBUFFER
+#define FOOTPRINT_BUDGET_RINGBUFFER 4
+#endif
+
+// LockedRingbuffer: Ringbuffer and mutex_t.
+#ifndef FOOTPRINT_BUDGET_LOCKEDRINGBUFFER
+#define FOOTPRINT_BUDGET_LOCKEDRINGBUFFER 8
+#endif
+
+// BlockingRingbuffer: Ringbuffer, mutex_t, two sema_t and the reader hand-off
+// state (sema_t, destination pointer and busy flag).
+#ifndef FOOTPRINT_BUDGET_BLOCKINGRINGBUFFER
+#define FOOTPRINT_BUDGET_BLOCKINGRINGBUFFER 52
+#endif
+
+// BlockingRingbuffer with keepout::LockDummy: Ringbuffer and two sema_t. The
+// hand-off is disabled and its state takes no space.
+#ifndef FOOTPRINT_BUDGET_BLOCKINGRINGBUFFER_NOHANDOFF
+#define FOOTPRINT_BUDGET_BLOCKINGRINGBUFFER_NOHANDOFF 32
+#endif
+
+// Mutex: mutex_t.
+#ifndef FOOTPRINT_BUDGET_MUTEX
+#define FOOTPRINT_BUDGET_MUTEX 4
+#endif
+
+// Semaphore: sema_t.
+#ifndef FOOTPRINT_BUDGET_SEMAPHORE
+#define FOOTPRINT_BUDGET_SEMAPHORE 12
+#endif
+
+// Fails compilation if the overhead of @p Container exceeds @p Budget.
+// @p Payload is the size of the elements stored in @p Container.
+template <typename Container, std::size_t Payload, std::size_t Budget>
+class FootprintBudget
+{
+    static_assert(sizeof(Container) >= Payload, "Payload exceeds sizeof(Container).");
+    static_assert(sizeof(Container) - Payload <= Budget, "RAM budget exceeded.");
+
+public:
+    static std::size_t const overhead = sizeof(Container) - Payload;
+};
+
+#endif // BUDGETS_HPP
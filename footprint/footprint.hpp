@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef FOOTPRINT_HPP
+#define FOOTPRINT_HPP
+
+#include <cstdint>
+#include "budgets.hpp"
+#include "riot/mutex.hpp"
+#include "riot/semaphore.hpp"
+#include "riot/array.hpp"
+#include "riot/ringbuffer.hpp"
+#include "riot/hashmap.hpp"
+#include "riot/priorityqueue.hpp"
+#include "riot/bitset.hpp"
+#include "riot/timerwheel.hpp"
+
+// Element with 16 bytes, used to vary the element size.
+class FootprintBlob
+{
+public:
+    uint8_t data[16];
+};
+
+// One global instance per instantiation. Its symbol in the linker map is
+// named after the instantiation, the symbol size is sizeof(T).
+template <typename T>
+class FootprintInstance
+{
+public:
+    static T object;
+};
+
+template <typename T>
+T FootprintInstance<T>::object;
+
+// Code using an instantiation. Kept out of line, so that the symbol of each
+// function in the linker map holds the text of one instantiation.
+template <typename Buffer>
+__attribute__((noinline)) auto footprintUseRingbuffer() -> void
+{
+    Buffer & b = FootprintInstance<Buffer>::object;
+    typename Buffer::ValueType v = typename Buffer::ValueType();
+    b.putOne(v);
+    b.addOne(v);
+    b.peekOne(v);
+    b.getOne(v);
+    b.add(&v, 1);
+    b.get(&v, 1);
+    b.remove(1);
+}
+
+template <typename Buffer>
+__attribute__((noinline)) auto footprintUseBlockingRingbuffer() -> void
+{
+    Buffer & b = FootprintInstance<Buffer>::object;
+    typename Buffer::ValueType v = typename Buffer::ValueType();
+    b.tryAdd(v);
+    b.tryGet(v);
+    b.addTimed(v, 0);
+    b.getTimed(v, 0);
+}
+
+template <typename T, std::size_t Size>
+__attribute__((noinline)) auto footprintUseRingbuffers() -> void
+{
+    typedef riot::Ringbuffer<T, Size> Plain;
+    typedef riot::LockedRingbuffer<T, Size> Locked;
+    typedef riot::BlockingRingbuffer<T, Size> Blocking;
+    typedef riot::BlockingRingbuffer<T, Size, Plain, riot::keepout::LockDummy> BlockingNoHandOff;
+
+    FootprintBudget<Plain, sizeof(T) * Size, FOOTPRINT_BUDGET_RINGBUFFER>();
+    FootprintBudget<Locked, sizeof(T) * Size, FOOTPRINT_BUDGET_LOCKEDRINGBUFFER>();
+    FootprintBudget<Blocking, sizeof(T) * Size, FOOTPRINT_BUDGET_BLOCKINGRINGBUFFER>();
+    FootprintBudget<BlockingNoHandOff, sizeof(T) * Size, FOOTPRINT_BUDGET_BLOCKINGRINGBUFFER_NOHANDOFF>();
+
+    footprintUseRingbuffer<Plain>();
+    footprintUseRingbuffer<Locked>();
+    footprintUseBlockingRingbuffer<Blocking>();
+    footprintUseBlockingRingbuffer<BlockingNoHandOff>();
+}
+
+__attribute__((noinline)) auto footprintUseSync() -> void
+{
+    FootprintBudget<riot::Mutex, 0, FOOTPRINT_BUDGET_MUTEX>();
+    FootprintBudget<riot::Semaphore, 0, FOOTPRINT_BUDGET_SEMAPHORE>();
+
+    riot::Mutex & m = FootprintInstance<riot::Mutex>::object;
+    m.lock();
+    m.unlock();
+    static riot::Semaphore s(0);
+    s.post();
+    s.tryWait();
+}
+
+__attribute__((noinline)) auto footprintUseContainers() -> void
+{
+    typedef riot::Array<uint32_t, 16> Array;
+    typedef riot::StaticHashMap<uint32_t, uint32_t, 16> Map;
+    typedef riot::PriorityQueue<uint32_t, 16> Queue;
+    typedef riot::Bitset<256> Bits;
+    typedef riot::TimerWheel<> Wheel;
+
+    uint32_t v = 0;
+    FootprintInstance<Array>::object.fill(v);
+    FootprintInstance<Map>::object.insert(v, v);
+    FootprintInstance<Map>::object.find(v, v);
+    FootprintInstance<Map>::object.erase(v);
+    FootprintInstance<Queue>::object.push(v);
+    FootprintInstance<Queue>::object.pop(v);
+    FootprintInstance<Bits>::object.set(v);
+    FootprintInstance<Bits>::object.findFirst();
+    FootprintInstance<Wheel>::object.tick();
+}
+
+// Use all instantiations of the footprint matrix.
+auto footprintUseAll() -> void
+{
+    footprintUseRingbuffers<uint8_t, 16>();
+    footprintUseRingbuffers<uint8_t, 256>();
+    footprintUseRingbuffers<uint32_t, 16>();
+    footprintUseRingbuffers<uint32_t, 256>();
+    footprintUseRingbuffers<FootprintBlob, 16>();
+    footprintUseSync();
+    footprintUseContainers();
+}
+
+#endif // FOOTPRINT_HPP
@@ -0,0 +1,68 @@
+#!/bin/sh
+#
+# Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+# Print the footprint of all wrapper instantiations from a linker map as CSV.
+# Requires a build with -ffunction-sections and -fdata-sections (RIOT default).
+#
+# usage: footprint.sh <mapfile>
+
+if [ $# -ne 1 ] || [ ! -f "$1" ]; then
+    echo "usage: $0 <mapfile>" >&2
+    exit 1
+fi
+
+CPPFILT=${CPPFILT:-c++filt}
+
+echo "region,bytes,symbol"
+awk '
+function hex2dec(h,    i, c, v) {
+    v = 0
+    h = tolower(h)
+    sub(/^0x/, "", h)
+    for (i = 1; i <= length(h); ++i) {
+        c = index("0123456789abcdef", substr(h, i, 1)) - 1
+        v = v * 16 + c
+    }
+    return v
+}
+function emit(section, size,    region, sym) {
+    if (size == 0) {
+        return
+    }
+    region = section
+    sub(/^\./, "", region)
+    sub(/\..*$/, "", region)
+    if (region == "text" || region == "rodata") {
+        region = "flash"
+    } else {
+        region = "ram"
+    }
+    sym = section
+    sub(/^\.(text|rodata|data|bss)\./, "", sym)
+    print region "," size "," sym
+}
+# Input section with address and size on the same line.
+/^ \.(text|rodata|data|bss)\.[^ ]+ +0x[0-9a-fA-F]+ +0x[0-9a-fA-F]+/ {
+    emit($1, hex2dec($3))
+    pending = ""
+    next
+}
+# Long input section names: Address and size follow on the next line.
+/^ \.(text|rodata|data|bss)\.[^ ]+$/ {
+    pending = $1
+    next
+}
+pending != "" && /^ +0x[0-9a-fA-F]+ +0x[0-9a-fA-F]+/ {
+    emit(pending, hex2dec($2))
+    pending = ""
+    next
+}
+{
+    pending = ""
+}
+' "$1" | $CPPFILT | grep -E 'riot::|footprint|Footprint' | sort -t, -k1,1 -k3,3
@@ -0,0 +1,15 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include "footprint.hpp"
+
+auto main(void) -> int
+{
+    footprintUseAll();
+    return 0;
+}
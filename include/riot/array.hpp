@@ -22,5 +22,6 @@
 #define ARRAY_HPP
 
 #include "array/array_impl.hpp"
+#include "array/soaarray_impl.hpp"
 
 #endif // MUTEX_HPP
@@ -0,0 +1,362 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Struct-of-arrays container. Stores every field of a record
+  *              in its own Array.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef SOAARRAY_IMPL_HPP
+#define SOAARRAY_IMPL_HPP
+
+#include <cstdint>
+#include "array_impl.hpp"
+
+namespace riot
+{
+namespace keepout
+{
+
+/**
+ * @brief Type of the @p I-th field in @p Fields.
+ */
+template <std::size_t I, typename Head, typename... Tail>
+class SoAFieldType
+{
+public:
+    typedef typename SoAFieldType<I - 1, Tail...>::Type Type;
+};
+
+template <typename Head, typename... Tail>
+class SoAFieldType<0, Head, Tail...>
+{
+public:
+    typedef Head Type;
+};
+
+/**
+ * @brief Recursive column storage. Every level holds the Array of one field.
+ */
+template <std::size_t Capacity, typename... Fields>
+class SoAStorage;
+
+template <std::size_t Capacity>
+class SoAStorage<Capacity>
+{
+public:
+    auto assign(std::size_t const) -> void
+    {
+    }
+
+    auto load(std::size_t const) const -> void
+    {
+    }
+
+    auto copy(std::size_t const, SoAStorage const &, std::size_t const) -> void
+    {
+    }
+};
+
+template <std::size_t Capacity, typename Head, typename... Tail>
+class SoAStorage<Capacity, Head, Tail...> : public SoAStorage<Capacity, Tail...>
+{
+public:
+    typedef SoAStorage<Capacity, Tail...> Base;
+
+    /**
+     * @brief Assign all fields of record @p pos.
+     */
+    auto assign(std::size_t const pos, Head const & head, Tail const &... tail) -> void
+    {
+        this->column[pos] = head;
+        Base::assign(pos, tail...);
+    }
+
+    /**
+     * @brief Copy all fields of record @p pos into the given references.
+     */
+    auto load(std::size_t const pos, Head & head, Tail &... tail) const -> void
+    {
+        head = this->column[pos];
+        Base::load(pos, tail...);
+    }
+
+    /**
+     * @brief Copy record @p srcPos of @p src into record @p pos.
+     */
+    auto copy(std::size_t const pos, SoAStorage const & src, std::size_t const srcPos) -> void
+    {
+        this->column[pos] = src.column[srcPos];
+        Base::copy(pos, src, srcPos);
+    }
+
+    Array<Head, Capacity> column;   /**< Storage of this field */
+};
+
+/**
+ * @brief Access the column of the @p I-th field.
+ */
+template <std::size_t I>
+class SoAColumn
+{
+public:
+    template <std::size_t Capacity, typename Head, typename... Tail>
+    static auto get(SoAStorage<Capacity, Head, Tail...> & s)
+        -> Array<typename SoAFieldType<I, Head, Tail...>::Type, Capacity> &
+    {
+        return SoAColumn<I - 1>::get(static_cast<SoAStorage<Capacity, Tail...> &>(s));
+    }
+
+    template <std::size_t Capacity, typename Head, typename... Tail>
+    static auto get(SoAStorage<Capacity, Head, Tail...> const & s)
+        -> Array<typename SoAFieldType<I, Head, Tail...>::Type, Capacity> const &
+    {
+        return SoAColumn<I - 1>::get(static_cast<SoAStorage<Capacity, Tail...> const &>(s));
+    }
+};
+
+template <>
+class SoAColumn<0>
+{
+public:
+    template <std::size_t Capacity, typename Head, typename... Tail>
+    static auto get(SoAStorage<Capacity, Head, Tail...> & s) -> Array<Head, Capacity> &
+    {
+        return s.column;
+    }
+
+    template <std::size_t Capacity, typename Head, typename... Tail>
+    static auto get(SoAStorage<Capacity, Head, Tail...> const & s) -> Array<Head, Capacity> const &
+    {
+        return s.column;
+    }
+};
+
+} // namespace keepout
+
+/**
+ * @brief Fixed size array of records, stored as one Array per field
+ *        (struct-of-arrays). A pass over a single field touches only the
+ *        memory of that field and there is no padding between fields.
+ * @note Per-field access via field<I>() returns the fields Array, which
+ *       provides SequenceIterators over that field. Whole records are
+ *       accessed through the proxy returned by operator [].
+ * @pre Every field type must be default constructible and copy-assignable.
+ */
+template <std::size_t Capacity, typename... Fields>
+class SoAArray
+{
+    static_assert(sizeof...(Fields) > 0, "SoAArray needs at least one field.");
+
+public:
+    // Member Types
+    typedef std::size_t SizeType;
+
+    template <std::size_t I>
+    using FieldType = typename keepout::SoAFieldType<I, Fields...>::Type;
+
+    template <std::size_t I>
+    using FieldArray = Array<FieldType<I>, Capacity>;
+
+    /**
+     * @brief Proxy referencing a single record.
+     */
+    class Reference
+    {
+    public:
+        /**
+         * @brief Constructor.
+         * @param[in] array   SoAArray containing the record.
+         * @param[in] pos     Index of the record.
+         */
+        Reference(SoAArray & array, SizeType const pos)
+            : array_(array)
+            , pos_(pos)
+        {
+        }
+
+        /**
+         * @brief Copy the referenced record of @p rhs into this record.
+         * @param[in] rhs   Proxy of the record to copy.
+         * @returns         Reference to this proxy.
+         */
+        auto operator = (Reference const & rhs) -> Reference &
+        {
+            this->array_.storage_.copy(this->pos_, rhs.array_.storage_, rhs.pos_);
+            return *this;
+        }
+
+        /**
+         * @brief Access the @p I-th field of the record.
+         * @returns   Reference to the field.
+         */
+        template <std::size_t I>
+        auto get() const -> FieldType<I> &
+        {
+            return this->array_.template field<I>()[this->pos_];
+        }
+
+        /**
+         * @brief Assign all fields of the record.
+         * @param[in] values   New field values, in field order.
+         */
+        auto assign(Fields const &... values) const -> void
+        {
+            this->array_.storage_.assign(this->pos_, values...);
+        }
+
+        /**
+         * @brief Copy all fields of the record.
+         * @param[out] values   References the fields are assigned to,
+         *                      in field order.
+         */
+        auto load(Fields &... values) const -> void
+        {
+            this->array_.storage_.load(this->pos_, values...);
+        }
+
+    private:
+        SoAArray & array_;   /**< Referenced SoAArray */
+        SizeType pos_;       /**< Referenced record index */
+    };
+
+    /**
+     * @brief Proxy referencing a single unmutable record.
+     */
+    class ConstReference
+    {
+    public:
+        /**
+         * @brief Constructor.
+         * @param[in] array   SoAArray containing the record.
+         * @param[in] pos     Index of the record.
+         */
+        ConstReference(SoAArray const & array, SizeType const pos)
+            : array_(array)
+            , pos_(pos)
+        {
+        }
+
+        /**
+         * @brief Access the @p I-th field of the record.
+         * @returns   Const reference to the field.
+         */
+        template <std::size_t I>
+        auto get() const -> FieldType<I> const &
+        {
+            return this->array_.template field<I>()[this->pos_];
+        }
+
+        /**
+         * @brief Copy all fields of the record.
+         * @param[out] values   References the fields are assigned to,
+         *                      in field order.
+         */
+        auto load(Fields &... values) const -> void
+        {
+            this->array_.storage_.load(this->pos_, values...);
+        }
+
+    private:
+        SoAArray const & array_;   /**< Referenced SoAArray */
+        SizeType pos_;             /**< Referenced record index */
+    };
+
+    /**
+     * @brief Default Constructor. Warning: No Array initialization.
+     */
+    SoAArray()
+    {
+    }
+
+    /**
+     * @brief Constructor: Initialize every record with the given field values.
+     * @param[in] values   Field values, in field order.
+     */
+    explicit SoAArray(Fields const &... values)
+    {
+        this->fill(values...);
+    }
+
+    /**
+     * @brief Operator [], mutable access to a record.
+     * @note Like a normal c array, [] performs no boundry checks.
+     * @param[in] pos   Index to the referenced record.
+     * @returns         Proxy referencing the @p pos-th record.
+     */
+    auto operator [] (SizeType const pos) -> Reference
+    {
+        return Reference(*this, pos);
+    }
+
+    /**
+     * @brief Operator [], unmutable access to a record.
+     * @note Like a normal c array, [] performs no boundry checks.
+     * @param[in] pos   Index to the referenced record.
+     * @returns         Proxy referencing the @p pos-th record.
+     */
+    auto operator [] (SizeType const pos) const -> ConstReference
+    {
+        return ConstReference(*this, pos);
+    }
+
+    /**
+     * @brief Mutable access to the Array storing the @p I-th field.
+     * @returns   Reference to the fields Array.
+     */
+    template <std::size_t I>
+    auto field() -> FieldArray<I> &
+    {
+        return keepout::SoAColumn<I>::get(this->storage_);
+    }
+
+    /**
+     * @brief Unmutable access to the Array storing the @p I-th field.
+     * @returns   Const reference to the fields Array.
+     */
+    template <std::size_t I>
+    auto field() const -> FieldArray<I> const &
+    {
+        return keepout::SoAColumn<I>::get(this->storage_);
+    }
+
+    /**
+     * @brief Returns the number of records. Always the value of the
+     *        first template parameter.
+     * @returns   Number of records.
+     */
+    auto size() const -> SizeType
+    {
+        return Capacity;
+    }
+
+    /**
+     * @brief Sets all records to the given field values.
+     * @param[in] values   Field values, in field order.
+     */
+    auto fill(Fields const &... values) -> void
+    {
+        for (SizeType i = 0; i < Capacity; ++i) {
+            this->storage_.assign(i, values...);
+        }
+    }
+
+private:
+    keepout::SoAStorage<Capacity, Fields...> storage_;   /**< Field storage */
+};
+
+} // namespace riot
+#endif // SOAARRAY_IMPL_HPP
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+/**
+ * @ingroup     riot_cpp_wrapper
+ * @{
+ *
+ * @file
+ * @brief       Metaheader including all Header for benchmarking.
+ *
+ * @author      Simon Brummer <simon.brummer@posteo.de>
+ *
+ * @}
+ */
+
+#include "bench/cyclecounter_impl.hpp"
+#include "bench/benchsuite_impl.hpp"
+
+#endif // BENCH_HPP
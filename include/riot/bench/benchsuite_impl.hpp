@@ -0,0 +1,305 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Micro-benchmark suite with calibration and statistical reporting.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef BENCHSUITE_IMPL_HPP
+#define BENCHSUITE_IMPL_HPP
+
+#include <cstdio>
+#include <cstdint>
+#include <cerrno>
+#include "xtimer.h"
+#include "cyclecounter_impl.hpp"
+#include "../array.hpp"
+
+namespace riot
+{
+
+namespace keepout
+{
+
+// Sort @p n values ascending. Sample counts are small: Insertion sort.
+inline auto benchSort(uint64_t * values, std::size_t n) -> void
+{
+    for (std::size_t i = 1; i < n; ++i) {
+        uint64_t tmp = values[i];
+        std::size_t j = i;
+        while (j > 0 && values[j - 1] > tmp) {
+            values[j] = values[j - 1];
+            --j;
+        }
+        values[j] = tmp;
+    }
+}
+
+// Integer square root (floor).
+inline auto benchSqrt(uint64_t value) -> uint64_t
+{
+    uint64_t res = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= res + bit) {
+            value -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    return res;
+}
+
+} // namespace keepout
+
+/**
+ * @brief Result of a benchmark case. All statistics are given in
+ *        thousandths of a counter tick per iteration.
+ */
+class BenchResult
+{
+public:
+    char const * name;
+    uint32_t iterations;
+    uint32_t samples;
+    uint64_t min;
+    uint64_t median;
+    uint64_t mean;
+    uint64_t stddev;
+};
+
+/**
+ * @brief Named benchmark case. The function must execute the measured
+ *        operation @p iterations times.
+ */
+class BenchCase
+{
+public:
+    typedef void (*Function)(void * arg, uint32_t iterations);
+
+    BenchCase()
+        : name(nullptr)
+        , function(nullptr)
+        , arg(nullptr)
+    {
+    }
+
+    char const * name;
+    Function function;
+    void * arg;
+};
+
+/**
+ * @brief Collection of up to @p MaxCases benchmark cases. Each case is
+ *        calibrated, so that a single sample runs at least minSampleUsec
+ *        microseconds. Afterwards @p Samples samples are measured with
+ *        the CycleCounter.
+ * @note No heap usage. Samples are stored on the stack of the caller.
+ */
+template <std::size_t MaxCases, std::size_t Samples = 15>
+class BenchSuite
+{
+    static_assert(MaxCases > 0, "BenchSuite MaxCases must not be zero.");
+    static_assert(Samples > 0, "BenchSuite Samples must not be zero.");
+
+public:
+    // Member Types
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Constructor.
+     * @param[in] minSampleUsec   Minimum duration of a calibrated sample.
+     */
+    explicit BenchSuite(uint32_t const minSampleUsec = 1000)
+        : size_(0)
+        , minSampleUsec_(minSampleUsec)
+    {
+        CycleCounter::init();
+    }
+
+    /**
+     * @brief Register benchmark case.
+     * @param[in] name       Name of the case. Must outlive the suite.
+     * @param[in] function   Function running the measured operation.
+     * @param[in] arg        Argument passed to @p function.
+     * @returns   Zero on success.
+     *            -EINVAL if @p name or @p function is null.
+     *            -ENOMEM if MaxCases cases are registered.
+     */
+    auto add(char const * name, BenchCase::Function function, void * arg = nullptr) -> int
+    {
+        if (name == nullptr || function == nullptr) {
+            return -EINVAL;
+        }
+        if (this->size_ == MaxCases) {
+            return -ENOMEM;
+        }
+        BenchCase & c = this->cases_[this->size_];
+        c.name = name;
+        c.function = function;
+        c.arg = arg;
+        this->size_ += 1;
+        return 0;
+    }
+
+    /**
+     * @brief Run a registered case.
+     * @param[in] index    Index of the case, in order of registration.
+     * @param[out] result  Measurement result.
+     * @returns   Zero on success.
+     *            -EINVAL if @p index is out of range.
+     */
+    auto run(SizeType const index, BenchResult & result) const -> int
+    {
+        if (index >= this->size_) {
+            return -EINVAL;
+        }
+        BenchCase const & c = this->cases_[index];
+        result.name = c.name;
+        result.iterations = calibrate_(c, this->minSampleUsec_);
+        result.samples = Samples;
+
+        uint64_t samples[Samples];
+        for (SizeType i = 0; i < Samples; ++i) {
+            CycleCounter::Ticks start = CycleCounter::now();
+            clobberMemory();
+            c.function(c.arg, result.iterations);
+            clobberMemory();
+            CycleCounter::Ticks stop = CycleCounter::now();
+            samples[i] = (CycleCounter::elapsed(start, stop) * 1000) / result.iterations;
+        }
+        statistics_(samples, result);
+        return 0;
+    }
+
+    /**
+     * @brief Run all registered cases and print the results as CSV.
+     */
+    auto runAll() const -> void
+    {
+        printHeader();
+        for (SizeType i = 0; i < this->size_; ++i) {
+            BenchResult result;
+            this->run(i, result);
+            print(result);
+        }
+    }
+
+    /**
+     * @brief Print the CSV header matching print().
+     */
+    static auto printHeader() -> void
+    {
+        printf("benchmark,iterations,samples,min,median,mean,stddev,unit\n");
+    }
+
+    /**
+     * @brief Print a result as CSV line.
+     * @param[in] result   Result to print.
+     */
+    static auto print(BenchResult const & result) -> void
+    {
+        printf("%s,%lu,%lu,", result.name,
+               static_cast<unsigned long>(result.iterations),
+               static_cast<unsigned long>(result.samples));
+        printFixed_(result.min);
+        printFixed_(result.median);
+        printFixed_(result.mean);
+        printFixed_(result.stddev);
+        printf("%s\n", CycleCounter::unit());
+    }
+
+    /**
+     * @brief Get number of registered cases.
+     * @returns   Number of registered cases.
+     */
+    auto size() const -> SizeType
+    {
+        return this->size_;
+    }
+
+    /**
+     * @brief Get maximum number of cases.
+     * @returns   MaxCases.
+     */
+    constexpr auto capacity() const -> SizeType
+    {
+        return MaxCases;
+    }
+
+    // Deleted with purpose
+    BenchSuite(BenchSuite const &) = delete;
+    BenchSuite(BenchSuite const &&) = delete;
+    auto operator = (BenchSuite const &) -> BenchSuite & = delete;
+    auto operator = (BenchSuite const &&) -> BenchSuite & = delete;
+
+private:
+    // Double iterations until a sample takes at least minSampleUsec.
+    static auto calibrate_(BenchCase const & c, uint32_t const minSampleUsec) -> uint32_t
+    {
+        uint32_t iterations = 1;
+        for (;;) {
+            uint64_t start = xtimer_now_usec64();
+            c.function(c.arg, iterations);
+            uint64_t usec = xtimer_now_usec64() - start;
+            if (usec >= minSampleUsec || iterations >= (1UL << 30)) {
+                return iterations;
+            }
+            iterations *= 2;
+        }
+    }
+
+    static auto statistics_(uint64_t * samples, BenchResult & result) -> void
+    {
+        keepout::benchSort(samples, Samples);
+        result.min = samples[0];
+        result.median = (Samples % 2) ? samples[Samples / 2]
+                                      : (samples[Samples / 2 - 1] + samples[Samples / 2]) / 2;
+        uint64_t sum = 0;
+        for (SizeType i = 0; i < Samples; ++i) {
+            sum += samples[i];
+        }
+        result.mean = sum / Samples;
+
+        uint64_t var = 0;
+        for (SizeType i = 0; i < Samples; ++i) {
+            uint64_t diff = (samples[i] > result.mean) ? samples[i] - result.mean
+                                                       : result.mean - samples[i];
+            var += diff * diff;
+        }
+        result.stddev = keepout::benchSqrt(var / Samples);
+    }
+
+    // Print thousandths with three decimal places followed by a comma.
+    static auto printFixed_(uint64_t const value) -> void
+    {
+        printf("%lu.%03lu,", static_cast<unsigned long>(value / 1000),
+               static_cast<unsigned long>(value % 1000));
+    }
+
+    Array<BenchCase, MaxCases> cases_;
+    SizeType size_;
+    uint32_t minSampleUsec_;
+};
+
+} // namespace riot
+
+#endif // BENCHSUITE_IMPL_HPP
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       High resolution counter and compiler barriers for benchmarks.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef CYCLECOUNTER_IMPL_HPP
+#define CYCLECOUNTER_IMPL_HPP
+
+#include <cstdint>
+#include "xtimer.h"
+
+namespace riot
+{
+
+/**
+ * @brief Access to the highest resolution counter of the platform.
+ *        x86 (native): Time stamp counter (rdtsc).
+ *        Cortex-M3/M4/M7/M33: DWT cycle counter (CYCCNT).
+ *        Otherwise: xtimer in microseconds.
+ */
+class CycleCounter
+{
+public:
+#if defined(__i386__) || defined(__x86_64__)
+    typedef uint64_t Ticks;
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+    typedef uint32_t Ticks;
+#else
+    typedef uint64_t Ticks;
+#endif
+
+    /**
+     * @brief Enable the counter. Must be called once before now() is used.
+     */
+    static auto init() -> void
+    {
+#if defined(__i386__) || defined(__x86_64__)
+        // Time stamp counter runs always.
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+        // Enable trace (DEMCR.TRCENA), reset and start CYCCNT (DWT_CTRL.CYCCNTENA).
+        *reinterpret_cast<uint32_t volatile *>(0xE000EDFC) |= (1UL << 24);
+        *reinterpret_cast<uint32_t volatile *>(0xE0001004) = 0;
+        *reinterpret_cast<uint32_t volatile *>(0xE0001000) |= 1UL;
+#endif
+    }
+
+    /**
+     * @brief Read the counter.
+     * @returns   Current counter value.
+     */
+    static auto now() -> Ticks
+    {
+#if defined(__i386__) || defined(__x86_64__)
+        uint32_t lo;
+        uint32_t hi;
+        __asm__ __volatile__ ("rdtsc" : "=a" (lo), "=d" (hi));
+        return (static_cast<uint64_t>(hi) << 32) | lo;
+#elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+        return *reinterpret_cast<uint32_t volatile *>(0xE0001004);
+#else
+        return xtimer_now_usec64();
+#endif
+    }
+
+    /**
+     * @brief Ticks between two counter values. Handles a single wrap around.
+     * @param[in] start   Counter value at start of the measurement.
+     * @param[in] stop    Counter value at end of the measurement.
+     * @returns   Elapsed ticks.
+     */
+    static auto elapsed(Ticks const start, Ticks const stop) -> uint64_t
+    {
+        return static_cast<Ticks>(stop - start);
+    }
+
+    /**
+     * @brief Unit of the counter.
+     * @returns   "cycles" if a cycle counter is used, "usec" on xtimer fallback.
+     */
+    static auto unit() -> char const *
+    {
+#if defined(__i386__) || defined(__x86_64__) || \
+    defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+        return "cycles";
+#else
+        return "usec";
+#endif
+    }
+};
+
+/**
+ * @brief Compiler barrier: Forces @p value to be materialized, so that
+ *        the computation of @p value can't be optimized away.
+ * @param[in] value   Value to keep.
+ */
+template <typename T>
+inline auto doNotOptimize(T const & value) -> void
+{
+    __asm__ __volatile__ ("" : : "r" (&value) : "memory");
+}
+
+/**
+ * @brief Compiler barrier: All pending memory writes are treated as observed.
+ */
+inline auto clobberMemory() -> void
+{
+    __asm__ __volatile__ ("" : : : "memory");
+}
+
+} // namespace riot
+
+#endif // CYCLECOUNTER_IMPL_HPP
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BITSET_HPP
+#define BITSET_HPP
+
+/**
+ * @ingroup     riot_cpp_wrapper
+ * @{
+ *
+ * @file
+ * @brief       Metaheader including all Header for bitsets.
+ *
+ * @author      Simon Brummer <simon.brummer@posteo.de>
+ *
+ * @}
+ */
+
+#include "bitset/bitset_impl.hpp"
+
+#endif // BITSET_HPP
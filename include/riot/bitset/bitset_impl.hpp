@@ -0,0 +1,454 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Fixed size bitset stored in machine words.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef BITSET_IMPL_HPP
+#define BITSET_IMPL_HPP
+
+#include <climits>
+#include <cstdint>
+#include <cerrno>
+#include "../array.hpp"
+
+namespace riot
+{
+
+// Forward declaration of Bitset.
+template <std::size_t N>
+class Bitset;
+
+// Forward declaration of Bitsets friend functions.
+template <std::size_t N>
+auto operator == (Bitset<N> const & lhs, Bitset<N> const & rhs) -> bool;
+
+/**
+ * @brief Bitset with @p N bits. Bits are packed into machine words,
+ *        searching and counting operate on whole words with the compilers
+ *        popcount, count-trailing-zero and count-leading-zero builtins.
+ */
+template <std::size_t N>
+class Bitset
+{
+    static_assert(N > 0, "Bitset N must not be zero.");
+
+public:
+    // Member Types
+    typedef unsigned int WordType;
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Default Constructor. All bits are reset.
+     */
+    Bitset()
+        : words_(0)
+    {
+    }
+
+    /**
+     * @brief Set bit at @p pos.
+     * @param[in] pos   Bit index.
+     * @returns         Zero on success.
+     *                  -EINVAL if @p pos is out of range.
+     */
+    auto set(SizeType const pos) -> int
+    {
+        if (pos >= N) {
+            return -EINVAL;
+        }
+        this->words_[wordIndex_(pos)] |= bitMask_(pos);
+        return 0;
+    }
+
+    /**
+     * @brief Reset bit at @p pos.
+     * @param[in] pos   Bit index.
+     * @returns         Zero on success.
+     *                  -EINVAL if @p pos is out of range.
+     */
+    auto reset(SizeType const pos) -> int
+    {
+        if (pos >= N) {
+            return -EINVAL;
+        }
+        this->words_[wordIndex_(pos)] &= ~bitMask_(pos);
+        return 0;
+    }
+
+    /**
+     * @brief Toggle bit at @p pos.
+     * @param[in] pos   Bit index.
+     * @returns         Zero on success.
+     *                  -EINVAL if @p pos is out of range.
+     */
+    auto flip(SizeType const pos) -> int
+    {
+        if (pos >= N) {
+            return -EINVAL;
+        }
+        this->words_[wordIndex_(pos)] ^= bitMask_(pos);
+        return 0;
+    }
+
+    /**
+     * @brief Check bit at @p pos.
+     * @param[in] pos   Bit index.
+     * @returns         true if bit at @p pos is set.
+     *                  false if not set or @p pos is out of range.
+     */
+    auto test(SizeType const pos) const -> bool
+    {
+        if (pos >= N) {
+            return false;
+        }
+        return (this->words_[wordIndex_(pos)] & bitMask_(pos)) != 0;
+    }
+
+    /**
+     * @brief Set all bits.
+     */
+    auto setAll() -> void
+    {
+        this->words_.fill(~WordType(0));
+        this->trim_();
+    }
+
+    /**
+     * @brief Reset all bits.
+     */
+    auto resetAll() -> void
+    {
+        this->words_.fill(0);
+    }
+
+    /**
+     * @brief Toggle all bits.
+     */
+    auto flipAll() -> void
+    {
+        for (SizeType i = 0; i < Words; ++i) {
+            this->words_[i] = ~(this->words_[i]);
+        }
+        this->trim_();
+    }
+
+    /**
+     * @brief Number of set bits.
+     * @returns   Number of set bits.
+     */
+    auto count() const -> SizeType
+    {
+        SizeType n = 0;
+        for (SizeType i = 0; i < Words; ++i) {
+            n += __builtin_popcount(this->words_[i]);
+        }
+        return n;
+    }
+
+    /**
+     * @brief Check if any bit is set.
+     * @returns   true if at least one bit is set.
+     */
+    auto any() const -> bool
+    {
+        for (SizeType i = 0; i < Words; ++i) {
+            if (this->words_[i] != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Check if no bit is set.
+     * @returns   true if all bits are reset.
+     */
+    auto none() const -> bool
+    {
+        return !this->any();
+    }
+
+    /**
+     * @brief Check if all bits are set.
+     * @returns   true if all bits are set.
+     */
+    auto all() const -> bool
+    {
+        return this->count() == N;
+    }
+
+    /**
+     * @brief Find the lowest set bit.
+     * @returns   Index of the lowest set bit. size() if no bit is set.
+     */
+    auto findFirst() const -> SizeType
+    {
+        return this->findFrom_(0, 0);
+    }
+
+    /**
+     * @brief Find the lowest set bit above @p pos.
+     * @param[in] pos   Bit index to start searching after.
+     * @returns         Index of the next set bit. size() if there is none.
+     */
+    auto findNext(SizeType const pos) const -> SizeType
+    {
+        return this->findFrom_(pos + 1, 0);
+    }
+
+    /**
+     * @brief Find the lowest reset bit, e.g. a free slot in an allocation map.
+     * @returns   Index of the lowest reset bit. size() if all bits are set.
+     */
+    auto findFirstReset() const -> SizeType
+    {
+        return this->findFrom_(0, ~WordType(0));
+    }
+
+    /**
+     * @brief Find the lowest reset bit above @p pos.
+     * @param[in] pos   Bit index to start searching after.
+     * @returns         Index of the next reset bit. size() if there is none.
+     */
+    auto findNextReset(SizeType const pos) const -> SizeType
+    {
+        return this->findFrom_(pos + 1, ~WordType(0));
+    }
+
+    /**
+     * @brief Find the highest set bit.
+     * @returns   Index of the highest set bit. size() if no bit is set.
+     */
+    auto findLast() const -> SizeType
+    {
+        for (SizeType i = Words; i > 0; --i) {
+            WordType word = this->words_[i - 1];
+            if (word != 0) {
+                return (i * WordBits) - 1 - __builtin_clz(word);
+            }
+        }
+        return N;
+    }
+
+    /**
+     * @brief Number of bits in the bitset.
+     *        Always the value of the template parameter.
+     * @returns   Bitset size.
+     */
+    auto size() const -> SizeType
+    {
+        return N;
+    }
+
+    /**
+     * @brief Bitwise and assignment.
+     * @param[in] rhs   Bitset to combine with.
+     * @returns         Reference to this object.
+     */
+    auto operator &= (Bitset const & rhs) -> Bitset &
+    {
+        for (SizeType i = 0; i < Words; ++i) {
+            this->words_[i] &= rhs.words_[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Bitwise or assignment.
+     * @param[in] rhs   Bitset to combine with.
+     * @returns         Reference to this object.
+     */
+    auto operator |= (Bitset const & rhs) -> Bitset &
+    {
+        for (SizeType i = 0; i < Words; ++i) {
+            this->words_[i] |= rhs.words_[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Bitwise xor assignment.
+     * @param[in] rhs   Bitset to combine with.
+     * @returns         Reference to this object.
+     */
+    auto operator ^= (Bitset const & rhs) -> Bitset &
+    {
+        for (SizeType i = 0; i < Words; ++i) {
+            this->words_[i] ^= rhs.words_[i];
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Bitwise not.
+     * @returns   Copy of this bitset with all bits toggled.
+     */
+    auto operator ~ () const -> Bitset
+    {
+        Bitset ret(*this);
+        ret.flipAll();
+        return ret;
+    }
+
+    /**
+     * @brief Get unmutable pointer to the underlaying words.
+     * @note Bit i is stored in word i / (bits per word) at
+     *       position i % (bits per word).
+     * @returns   Pointer to the first word.
+     */
+    auto data() const -> WordType const *
+    {
+        return this->words_.data();
+    }
+
+private:
+    static constexpr SizeType WordBits = sizeof(WordType) * CHAR_BIT;
+    static constexpr SizeType Words = (N + WordBits - 1) / WordBits;
+
+    /**
+     * @brief Calculate word index of bit @p pos.
+     * @param[in] pos   Bit index.
+     * @returns         Index of the word containing @p pos.
+     */
+    static auto wordIndex_(SizeType const pos) -> SizeType
+    {
+        return pos / WordBits;
+    }
+
+    /**
+     * @brief Calculate word mask of bit @p pos.
+     * @param[in] pos   Bit index.
+     * @returns         Mask selecting @p pos within its word.
+     */
+    static auto bitMask_(SizeType const pos) -> WordType
+    {
+        return WordType(1) << (pos % WordBits);
+    }
+
+    /**
+     * @brief Clear unused bits in the last word.
+     */
+    auto trim_() -> void
+    {
+        if (N % WordBits != 0) {
+            this->words_[Words - 1] &= (WordType(1) << (N % WordBits)) - 1;
+        }
+    }
+
+    /**
+     * @brief Find lowest bit at or above @p pos that is set after
+     *        xor with @p invert.
+     * @param[in] pos      Bit index to start searching at.
+     * @param[in] invert   Zero to search set bits, all ones to search
+     *                     reset bits.
+     * @returns            Found bit index. N if there is none.
+     */
+    auto findFrom_(SizeType const pos, WordType const invert) const -> SizeType
+    {
+        if (pos >= N) {
+            return N;
+        }
+        SizeType i = wordIndex_(pos);
+        // Mask bits below pos in the first word.
+        WordType word = (this->words_[i] ^ invert) & ~(bitMask_(pos) - 1);
+        for (;;) {
+            if (word != 0) {
+                SizeType found = i * WordBits + __builtin_ctz(word);
+                return (found < N) ? found : N;
+            }
+            i += 1;
+            if (i == Words) {
+                return N;
+            }
+            word = this->words_[i] ^ invert;
+        }
+    }
+
+    Array<WordType, Words> words_;   /**< Bit storage */
+
+    friend auto operator == <N>(Bitset const & lhs, Bitset const & rhs) -> bool;
+};
+
+/**
+ * @brief == operator on bitsets of the same size.
+ * @param[in] lhs   Leftside of the operator.
+ * @param[in] rhs   Rightside of the operator.
+ * @returns         true if lhs and rhs have the same bits set.
+ */
+template <std::size_t N>
+auto operator == (Bitset<N> const & lhs, Bitset<N> const & rhs) -> bool
+{
+    return (lhs.words_ == rhs.words_);
+}
+
+/**
+ * @brief != operator on bitsets of the same size.
+ * @param[in] lhs   Leftside of the operator.
+ * @param[in] rhs   Rightside of the operator.
+ * @returns         true if lhs and rhs differ.
+ */
+template <std::size_t N>
+auto operator != (Bitset<N> const & lhs, Bitset<N> const & rhs) -> bool
+{
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Bitwise and on bitsets of the same size.
+ * @param[in] lhs   Leftside of the operator.
+ * @param[in] rhs   Rightside of the operator.
+ * @returns         Bitset containing lhs & rhs.
+ */
+template <std::size_t N>
+auto operator & (Bitset<N> const & lhs, Bitset<N> const & rhs) -> Bitset<N>
+{
+    Bitset<N> ret(lhs);
+    ret &= rhs;
+    return ret;
+}
+
+/**
+ * @brief Bitwise or on bitsets of the same size.
+ * @param[in] lhs   Leftside of the operator.
+ * @param[in] rhs   Rightside of the operator.
+ * @returns         Bitset containing lhs | rhs.
+ */
+template <std::size_t N>
+auto operator | (Bitset<N> const & lhs, Bitset<N> const & rhs) -> Bitset<N>
+{
+    Bitset<N> ret(lhs);
+    ret |= rhs;
+    return ret;
+}
+
+/**
+ * @brief Bitwise xor on bitsets of the same size.
+ * @param[in] lhs   Leftside of the operator.
+ * @param[in] rhs   Rightside of the operator.
+ * @returns         Bitset containing lhs ^ rhs.
+ */
+template <std::size_t N>
+auto operator ^ (Bitset<N> const & lhs, Bitset<N> const & rhs) -> Bitset<N>
+{
+    Bitset<N> ret(lhs);
+    ret ^= rhs;
+    return ret;
+}
+
+} // namespace riot
+#endif // BITSET_IMPL_HPP
@@ -0,0 +1,29 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef COROUTINE_HPP
+#define COROUTINE_HPP
+
+/**
+ * @ingroup     riot_cpp_wrapper
+ * @{
+ *
+ * @file
+ * @brief       Metaheader including all Headers for coroutines.
+ *              Requires C++20, the rest of the library stays C++14.
+ *
+ * @author      Simon Brummer <simon.brummer@posteo.de>
+ *
+ * @}
+ */
+
+#include "coroutine/task_impl.hpp"
+#include "coroutine/executor_impl.hpp"
+#include "coroutine/awaitables_impl.hpp"
+
+#endif // COROUTINE_HPP
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Awaitables for BlockingRingbuffer and WatchableSemaphore.
+  *              Requires C++20.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef AWAITABLES_IMPL_HPP
+#define AWAITABLES_IMPL_HPP
+
+#include "../semaphore/watchablesemaphore_impl.hpp"
+#include "executor_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Awaitable getting the oldest element of a blocking ringbuffer.
+ * @note @p Queue must provide tryGet() and watch(), e.g. BlockingRingbuffer
+ *       with Sema = WatchableSemaphore.
+ */
+template <typename Queue>
+class AsyncGet : public TaskAwaiter<AsyncGet<Queue>>
+{
+public:
+    AsyncGet(Queue & queue, typename Queue::Reference dst)
+        : queue_(queue)
+        , dst_(dst)
+    {
+    }
+
+    auto attempt() -> int
+    {
+        return this->queue_.tryGet(this->dst_);
+    }
+
+    auto watch(SemaphoreWatch * w) -> void
+    {
+        this->queue_.watch(w);
+    }
+
+private:
+    Queue & queue_;                   /**< Queue to get from */
+    typename Queue::Reference dst_;   /**< Destination of the element */
+};
+
+/**
+ * @brief Awaitable adding an element to a blocking ringbuffer.
+ * @note @p Queue must provide tryAdd() and watch(), e.g. BlockingRingbuffer
+ *       with Sema = WatchableSemaphore.
+ */
+template <typename Queue>
+class AsyncAdd : public TaskAwaiter<AsyncAdd<Queue>>
+{
+public:
+    AsyncAdd(Queue & queue, typename Queue::ConstReference src)
+        : queue_(queue)
+        , src_(src)
+    {
+    }
+
+    auto attempt() -> int
+    {
+        return this->queue_.tryAdd(this->src_);
+    }
+
+    auto watch(SemaphoreWatch * w) -> void
+    {
+        this->queue_.watch(w);
+    }
+
+private:
+    Queue & queue_;                       /**< Queue to add to */
+    typename Queue::ConstReference src_;  /**< Element to add */
+};
+
+/**
+ * @brief Awaitable decrementing a WatchableSemaphore.
+ */
+class AsyncWait : public TaskAwaiter<AsyncWait>
+{
+public:
+    AsyncWait(WatchableSemaphore & sema)
+        : sema_(sema)
+    {
+    }
+
+    auto attempt() -> int
+    {
+        return this->sema_.tryWait();
+    }
+
+    auto watch(SemaphoreWatch * w) -> void
+    {
+        this->sema_.watch(w);
+    }
+
+private:
+    WatchableSemaphore & sema_; /**< Semaphore to wait on */
+};
+
+/**
+ * @brief Get the oldest element of @p queue without blocking the thread.
+ * @note Usage inside a Task: int err = co_await riot::asyncGet(queue, dst);
+ *       Registers the executor as the watch of @p queue.
+ * @param[in]  queue   Blocking ringbuffer with Sema = WatchableSemaphore.
+ * @param[out] dst     Reference to object there the aquired element is
+ *                     stored into. Must stay valid until co_await returns.
+ * @returns   Awaitable returning the result of tryGet(): Zero on success.
+ *            -EOVERFLOW if writer semaphore overflowed.
+ *            -ECANCELED if ringbuffer is destroyed.
+ */
+template <typename Queue>
+auto asyncGet(Queue & queue, typename Queue::Reference dst) -> AsyncGet<Queue>
+{
+    return AsyncGet<Queue>(queue, dst);
+}
+
+/**
+ * @brief Add an element to @p queue without blocking the thread.
+ * @note Usage inside a Task: int err = co_await riot::asyncAdd(queue, src);
+ *       Registers the executor as the watch of @p queue.
+ * @param[in] queue   Blocking ringbuffer with Sema = WatchableSemaphore.
+ * @param[in] src     Reference to object to place into ringbuffer. Must stay
+ *                    valid until co_await returns.
+ * @returns   Awaitable returning the result of tryAdd(): Zero on success.
+ *            -EOVERFLOW if reader semaphore overflowed.
+ *            -ECANCELED if ringbuffer is destroyed.
+ */
+template <typename Queue>
+auto asyncAdd(Queue & queue, typename Queue::ConstReference src) -> AsyncAdd<Queue>
+{
+    return AsyncAdd<Queue>(queue, src);
+}
+
+/**
+ * @brief Decrement @p sema without blocking the thread.
+ * @note Usage inside a Task: int err = co_await riot::asyncWait(sema);
+ *       Registers the executor as the watch of @p sema.
+ * @param[in] sema   Semaphore to wait on.
+ * @returns   Awaitable returning the result of tryWait(): Zero on success.
+ *            -ECANCELED if the semaphore was destroyed.
+ */
+inline auto asyncWait(WatchableSemaphore & sema) -> AsyncWait
+{
+    return AsyncWait(sema);
+}
+
+} // namespace riot
+#endif // AWAITABLES_IMPL_HPP
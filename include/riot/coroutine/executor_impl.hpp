@@ -0,0 +1,239 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Single thread executor for coroutine tasks. Requires C++20
+  *              and 'sema' Module.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef EXECUTOR_IMPL_HPP
+#define EXECUTOR_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "../semaphore/semaphore_impl.hpp"
+#include "../semaphore/watchablesemaphore_impl.hpp"
+#include "task_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Runs any number of Tasks on the stack of the calling thread.
+ * @note Tasks switch only at co_await. A Task waiting on an awaitable is
+ *       retried whenever a watched semaphore was posted, the executor thread
+ *       sleeps while no Task can make progress.
+ * @note Not threadsafe: spawn() and run() must be called from the executor
+ *       thread. notify() may be called from any thread or interrupt.
+ */
+class Executor
+{
+public:
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Default Constructor. Create executor without Tasks.
+     */
+    Executor()
+        : head_(nullptr)
+        , tail_(nullptr)
+        , pending_(0)
+        , wakeSema_(0)
+    {
+        this->watch_.notify = &Executor::notify_;
+        this->watch_.arg = this;
+    }
+
+    /**
+     * @brief Destructor. Destroys all unfinished Tasks.
+     */
+    ~Executor()
+    {
+        while (this->head_ != nullptr) {
+            TaskPromise * p = this->head_;
+            this->head_ = p->next;
+            Task::HandleType::from_promise(*p).destroy();
+        }
+    }
+
+    /**
+     * @brief Take over @p task. It starts running in run().
+     * @param[in] task   Task to run. Invalid afterwards.
+     * @returns   Zero on success.
+     *            -ENOMEM if @p task holds no coroutine, because the frame did
+     *            not fit into its TaskMemory or it was already spawned.
+     */
+    auto spawn(Task & task) -> int
+    {
+        if (!task.valid()) {
+            return -ENOMEM;
+        }
+        TaskPromise & p = task.release().promise();
+        p.executor = this;
+        p.next = nullptr;
+        if (this->tail_ == nullptr) {
+            this->head_ = &p;
+        } else {
+            this->tail_->next = &p;
+        }
+        this->tail_ = &p;
+        return 0;
+    }
+
+    /**
+     * @brief Run all Tasks until they finished.
+     * @note Blocks the calling thread while all Tasks are waiting.
+     */
+    auto run() -> void
+    {
+        while (this->head_ != nullptr) {
+            __atomic_store_n(&this->pending_, 0, __ATOMIC_SEQ_CST);
+            if (this->runOnce() == 0) {
+                this->wakeSema_.wait();
+            }
+        }
+    }
+
+    /**
+     * @brief Resume each Task once, if it can make progress. Never blocks.
+     * @note Lets an existing event loop drive the executor.
+     * @returns   Number of resumed Tasks.
+     */
+    auto runOnce() -> SizeType
+    {
+        SizeType resumed = 0;
+        TaskPromise * prev = nullptr;
+        TaskPromise * p = this->head_;
+        while (p != nullptr) {
+            TaskPromise * next = p->next;
+            if (p->attempt == nullptr || p->attempt(p->awaiter)) {
+                p->attempt = nullptr;
+                Task::HandleType h = Task::HandleType::from_promise(*p);
+                h.resume();
+                resumed += 1;
+                if (h.done()) {
+                    // Unlink and free the frame of the finished Task
+                    if (prev == nullptr) {
+                        this->head_ = next;
+                    } else {
+                        prev->next = next;
+                    }
+                    if (this->tail_ == p) {
+                        this->tail_ = prev;
+                    }
+                    h.destroy();
+                    p = next;
+                    continue;
+                }
+            }
+            prev = p;
+            p = next;
+        }
+        return resumed;
+    }
+
+    /**
+     * @brief Wake run() to retry all waiting Tasks.
+     * @note Callable from any thread or interrupt.
+     */
+    auto notify() -> void
+    {
+        if (__atomic_exchange_n(&this->pending_, 1, __ATOMIC_ACQ_REL) == 0) {
+            this->wakeSema_.post();
+        }
+    }
+
+    /**
+     * @brief Watch calling notify(). Awaitables register it on the
+     *        WatchableSemaphore they wait on.
+     * @returns   Pointer to the watch of the executor.
+     */
+    auto semaphoreWatch() -> SemaphoreWatch *
+    {
+        return &this->watch_;
+    }
+
+private:
+    static auto notify_(void * arg) -> void
+    {
+        static_cast<Executor *>(arg)->notify();
+    }
+
+    TaskPromise * head_;    /**< First spawned, unfinished Task */
+    TaskPromise * tail_;    /**< Last spawned, unfinished Task */
+    uint8_t pending_;       /**< notify() was called since the last pass */
+    Semaphore wakeSema_;    /**< Posted once per pending notification */
+    SemaphoreWatch watch_;  /**< Watch calling notify() */
+
+    // Deleted with purpose
+    Executor(Executor const &) = delete;
+    Executor(Executor const &&) = delete;
+    auto operator = (Executor const &) -> Executor & = delete;
+    auto operator = (Executor const &&) -> Executor & = delete;
+};
+
+/**
+ * @brief Base of awaitables usable in Tasks.
+ * @note @p Derived provides attempt(), a non-blocking try of the operation
+ *       returning -EAGAIN if it would block, and watch(SemaphoreWatch *),
+ *       registering the watch on the semaphores signalling progress.
+ *       co_await returns the result of the successful attempt().
+ */
+template <typename Derived>
+class TaskAwaiter
+{
+public:
+    TaskAwaiter()
+        : result_(-EAGAIN)
+    {
+    }
+
+    auto await_ready() -> bool
+    {
+        return attempt_(this);
+    }
+
+    auto await_suspend(Task::HandleType h) -> bool
+    {
+        TaskPromise & p = h.promise();
+        static_cast<Derived *>(this)->watch(p.executor->semaphoreWatch());
+        // Retry, the operation could have become possible before the watch was set.
+        if (attempt_(this)) {
+            return false;
+        }
+        p.awaiter = this;
+        p.attempt = &TaskAwaiter::attempt_;
+        return true;
+    }
+
+    auto await_resume() const -> int
+    {
+        return this->result_;
+    }
+
+private:
+    static auto attempt_(void * awaiter) -> bool
+    {
+        TaskAwaiter * self = static_cast<TaskAwaiter *>(awaiter);
+        self->result_ = static_cast<Derived *>(self)->attempt();
+        return self->result_ != -EAGAIN;
+    }
+
+    int result_; /**< Result of the last attempt */
+};
+
+} // namespace riot
+#endif // EXECUTOR_IMPL_HPP
@@ -0,0 +1,276 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Coroutine task type with statically allocated frames.
+  *              Requires C++20.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef TASK_IMPL_HPP
+#define TASK_IMPL_HPP
+
+#if !defined(__cpp_impl_coroutine)
+#error "riot/coroutine.hpp requires C++20 coroutine support (e.g. -std=c++20)."
+#endif
+
+#include <cstdint>
+#include <coroutine>
+
+namespace riot
+{
+
+class Task;
+class Executor;
+
+/**
+ * @brief Memory a single coroutine frame is placed in. Coroutine frames
+ *        are never allocated from the heap.
+ * @note Holds one frame at a time. The memory is released as soon as the
+ *       coroutine finished and can be reused by the next coroutine.
+ */
+class TaskMemory
+{
+public:
+    /**
+     * @brief Check if a coroutine frame is placed in the memory.
+     * @returns   true if the memory is in use.
+     *            false if the memory is free.
+     */
+    auto used() const -> bool
+    {
+        return this->used_;
+    }
+
+    /**
+     * @brief Place a frame of @p n bytes into the memory.
+     * @param[in] n   Size of the coroutine frame.
+     * @returns   Pointer to the frame. nullptr if the memory is in use
+     *            or smaller than @p n.
+     */
+    auto allocate(std::size_t const n) -> void *
+    {
+        if (this->used_ || n > this->size_) {
+            return nullptr;
+        }
+        this->used_ = true;
+        return this->mem_;
+    }
+
+    /**
+     * @brief Release the frame placed in the memory.
+     */
+    auto release() -> void
+    {
+        this->used_ = false;
+    }
+
+protected:
+    TaskMemory(void * mem, std::size_t const size)
+        : mem_(mem)
+        , size_(size)
+        , used_(false)
+    {
+    }
+
+private:
+    void * mem_;       /**< Start of the memory */
+    std::size_t size_; /**< Size of the memory in bytes */
+    bool used_;        /**< A frame is placed in the memory */
+
+    // Deleted with purpose
+    TaskMemory(TaskMemory const &) = delete;
+    TaskMemory(TaskMemory const &&) = delete;
+    auto operator = (TaskMemory const &) -> TaskMemory & = delete;
+    auto operator = (TaskMemory const &&) -> TaskMemory & = delete;
+};
+
+/**
+ * @brief TaskMemory for coroutine frames of up to @p Bytes bytes.
+ * @note The frame size depends on the locals of the coroutine and the
+ *       compiler. Too small memory lets spawning the Task fail with -ENOMEM.
+ */
+template <std::size_t Bytes>
+class TaskFrame : public TaskMemory
+{
+public:
+    TaskFrame()
+        : TaskMemory(this->mem_, Bytes)
+    {
+    }
+
+private:
+    alignas(__BIGGEST_ALIGNMENT__) uint8_t mem_[Bytes]; /**< Frame storage */
+};
+
+/**
+ * @brief Promise of Task. Links the coroutine into its Executor.
+ */
+class TaskPromise
+{
+public:
+    TaskPromise()
+        : executor(nullptr)
+        , next(nullptr)
+        , awaiter(nullptr)
+        , attempt(nullptr)
+    {
+    }
+
+    /**
+     * @brief Place the coroutine frame into the TaskMemory passed as first
+     *        argument of the coroutine.
+     */
+    template <typename... Args>
+    static auto operator new(std::size_t const n, TaskMemory & mem, Args &...) noexcept -> void *
+    {
+        uint8_t * p = static_cast<uint8_t *>(mem.allocate(n + Header));
+        if (p == nullptr) {
+            return nullptr;
+        }
+        *reinterpret_cast<TaskMemory **>(p) = &mem;
+        return p + Header;
+    }
+
+    // A coroutine returning Task must take TaskMemory & as first argument.
+    static auto operator new(std::size_t const n) -> void * = delete;
+
+    static auto operator delete(void * frame) -> void
+    {
+        uint8_t * p = static_cast<uint8_t *>(frame) - Header;
+        (*reinterpret_cast<TaskMemory **>(p))->release();
+    }
+
+    static auto get_return_object_on_allocation_failure() -> Task;
+    auto get_return_object() -> Task;
+
+    auto initial_suspend() noexcept -> std::suspend_always
+    {
+        return std::suspend_always();
+    }
+
+    auto final_suspend() noexcept -> std::suspend_always
+    {
+        return std::suspend_always();
+    }
+
+    auto return_void() -> void
+    {
+    }
+
+    auto unhandled_exception() -> void
+    {
+    }
+
+    Executor * executor;              /**< Executor running the coroutine */
+    TaskPromise * next;               /**< Next coroutine of the executor */
+    void * awaiter;                   /**< Awaitable the coroutine waits on */
+    auto (*attempt)(void *) -> bool;  /**< Retry awaiter. nullptr if runnable */
+
+private:
+    static constexpr std::size_t Header = __BIGGEST_ALIGNMENT__; /**< Space for owner */
+    static_assert(sizeof(TaskMemory *) <= Header, "TaskPromise Header too small.");
+};
+
+/**
+ * @brief Return type of coroutines run by an Executor.
+ * @note Declare coroutines as
+ *       riot::Task worker(riot::TaskMemory & mem, ...);
+ *       The frame is placed into @p mem. Create the Task by calling the
+ *       coroutine and hand it to Executor::spawn(). The coroutine starts
+ *       running inside Executor::run().
+ */
+class Task
+{
+public:
+    typedef TaskPromise promise_type;
+    typedef std::coroutine_handle<TaskPromise> HandleType;
+
+    /**
+     * @brief Default Constructor. Create Task without coroutine.
+     */
+    Task()
+        : handle_()
+    {
+    }
+
+    /**
+     * @brief Take the coroutine from @p rhs.
+     */
+    Task(Task && rhs)
+        : handle_(rhs.handle_)
+    {
+        rhs.handle_ = HandleType();
+    }
+
+    /**
+     * @brief Destructor. Destroys a coroutine that was never spawned.
+     */
+    ~Task()
+    {
+        if (this->handle_) {
+            this->handle_.destroy();
+        }
+    }
+
+    /**
+     * @brief Check if the Task holds a coroutine.
+     * @returns   false if the frame did not fit into its TaskMemory or the
+     *            Task was already spawned.
+     */
+    auto valid() const -> bool
+    {
+        return static_cast<bool>(this->handle_);
+    }
+
+    /**
+     * @brief Give up ownership of the coroutine.
+     * @returns   Handle of the coroutine.
+     */
+    auto release() -> HandleType
+    {
+        HandleType h = this->handle_;
+        this->handle_ = HandleType();
+        return h;
+    }
+
+private:
+    friend class TaskPromise;
+
+    explicit Task(HandleType h)
+        : handle_(h)
+    {
+    }
+
+    HandleType handle_; /**< Owned coroutine */
+
+    // Deleted with purpose
+    Task(Task const &) = delete;
+    auto operator = (Task const &) -> Task & = delete;
+    auto operator = (Task &&) -> Task & = delete;
+};
+
+inline auto TaskPromise::get_return_object_on_allocation_failure() -> Task
+{
+    return Task();
+}
+
+inline auto TaskPromise::get_return_object() -> Task
+{
+    return Task(Task::HandleType::from_promise(*this));
+}
+
+} // namespace riot
+#endif // TASK_IMPL_HPP
@@ -0,0 +1,28 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef HASHMAP_HPP
+#define HASHMAP_HPP
+
+/**
+ * @ingroup     riot_cpp_wrapper
+ * @{
+ *
+ * @file
+ * @brief       Metaheader including all Header for hashmaps.
+ *
+ * @author      Simon Brummer <simon.brummer@posteo.de>
+ *
+ * @}
+ */
+
+#include "hashmap/hash_impl.hpp"
+#include "hashmap/hashmapiterator_impl.hpp"
+#include "hashmap/statichashmap_impl.hpp"
+
+#endif // HASHMAP_HPP
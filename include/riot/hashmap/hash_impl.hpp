@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Default hash function object used by hashmaps.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef HASH_IMPL_HPP
+#define HASH_IMPL_HPP
+
+#include <cstdint>
+
+namespace riot
+{
+
+/**
+ * @brief Default hash function object. Calculates a 32-Bit FNV-1a hash
+ *        over the object representation of a key.
+ * @note Keys containing padding bytes or pointers to the actual data
+ *       must supply their own hash function object.
+ */
+template <typename K>
+class Hash
+{
+public:
+    /**
+     * @brief Calculate hash value of @p key.
+     * @param[in] key   Reference to the key to hash.
+     * @returns         Hash value of @p key.
+     */
+    auto operator () (K const & key) const -> uint32_t
+    {
+        uint8_t const * p = reinterpret_cast<uint8_t const *>(&key);
+        uint32_t hash = 2166136261u;
+        for (std::size_t i = 0; i < sizeof(K); ++i) {
+            hash ^= p[i];
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+};
+
+} // namespace riot
+#endif // HASH_IMPL_HPP
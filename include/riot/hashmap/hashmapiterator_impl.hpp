@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Implementation: Iterator over the occupied slots of
+  *              an open addressing hashmap.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef HASHMAPITERATOR_IMPL_HPP
+#define HASHMAPITERATOR_IMPL_HPP
+
+#include <cstdint>
+
+namespace riot
+{
+
+// Forward declaration of HashMapIterator.
+template <typename T, typename D>
+class HashMapIterator;
+
+// Forward declaration of HashMapIterators friend functions.
+template <typename T, typename D>
+auto operator == (HashMapIterator<T, D> const & lhs,
+                  HashMapIterator<T, D> const & rhs) -> bool;
+
+// Implementation of HashMapIterator
+template <typename T, typename D>
+class HashMapIterator
+{
+public:
+    // Member Types
+    typedef T ValueType;
+    typedef T & Reference;
+    typedef T * Pointer;
+    typedef D const * DistancePointer;
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Fully-specified Constructor.
+     * @note A slot is occupied if its distance is non-zero.
+     * @param[in] slots      Pointer to the first slot of the hashmap.
+     * @param[in] dists      Pointer to the first probe distance of the hashmap.
+     * @param[in] capacity   Number of slots in the hashmap.
+     * @param[in] pos        Slot index the iterator is pointing to.
+     */
+    HashMapIterator(Pointer slots, DistancePointer dists, SizeType capacity,
+                    SizeType pos)
+        : slots_(slots)
+        , dists_(dists)
+        , capacity_(capacity)
+        , pos_(pos)
+    {
+    }
+
+    /**
+     * @brief Move iterator to next occupied slot.
+     * @returns   Ref to iterator, pointing to next element.
+     */
+    auto operator ++ () -> HashMapIterator &
+    {
+        do {
+            this->pos_ += 1;
+        } while (this->pos_ < this->capacity_ && this->dists_[this->pos_] == 0);
+        return *this;
+    }
+
+    /**
+     * @brief Move iterator to previous occupied slot.
+     * @note Moving before the first slot wraps the index past capacity,
+     *       which ends the search.
+     * @returns   Ref to iterator, pointing to previous element.
+     */
+    auto operator -- () -> HashMapIterator &
+    {
+        do {
+            this->pos_ -= 1;
+        } while (this->pos_ < this->capacity_ && this->dists_[this->pos_] == 0);
+        return *this;
+    }
+
+    /**
+     * @brief Dereference iterator.
+     * @returns   Ref to the object, the iterator is pointing to.
+     */
+    auto operator * () const -> Reference
+    {
+        return this->slots_[this->pos_];
+    }
+
+    /**
+     * @brief Dereferences iterator.
+     * @returns   Pointer to dereferenced object, the iterator is pointing to.
+     */
+    auto operator -> () const -> Pointer
+    {
+        return this->slots_ + this->pos_;
+    }
+
+private:
+    Pointer slots_;          /**< Pointer to the hashmaps slots */
+    DistancePointer dists_;  /**< Pointer to the hashmaps probe distances */
+    SizeType capacity_;      /**< Number of slots */
+    SizeType pos_;           /**< Index of the current slot */
+
+    friend auto operator == <T, D>(HashMapIterator const & lhs,
+                                   HashMapIterator const & rhs) -> bool;
+};
+
+/**
+ * @brief equal comparrison operator on HashMapIterators.
+ * @param[in] lhs   Leftside of the operator.
+ * @param[in] rhs   Rightside of the operator.
+ * @returns         true if the Iterators pointing to the same slot.
+ */
+template <typename T, typename D>
+auto operator == (HashMapIterator<T, D> const & lhs,
+                  HashMapIterator<T, D> const & rhs) -> bool
+{
+    return (lhs.slots_ == rhs.slots_ && lhs.pos_ == rhs.pos_);
+}
+
+/**
+ * @brief not equal comparrison operator on HashMapIterators.
+ * @param[in] lhs   Leftside of the operator.
+ * @param[in] rhs   Rightside of the operator.
+ * @returns         true if the Iterators pointing to different slots.
+ */
+template <typename T, typename D>
+auto operator != (HashMapIterator<T, D> const & lhs,
+                  HashMapIterator<T, D> const & rhs) -> bool
+{
+    return !(lhs == rhs);
+}
+
+} // namespace riot
+#endif // HASHMAPITERATOR_IMPL_HPP
@@ -0,0 +1,422 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Fixed capacity hashmap. Open addressing with robin hood
+  *              probing and backward shift deletion.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef STATICHASHMAP_IMPL_HPP
+#define STATICHASHMAP_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "../array.hpp"
+#include "../iterator.hpp"
+#include "hash_impl.hpp"
+#include "hashmapiterator_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Key-Value pair stored in a StaticHashMap slot.
+ */
+template <typename K, typename V>
+class HashMapEntry
+{
+public:
+    K key;     /**< Key of this entry. Must not be modified while stored. */
+    V value;   /**< Value associated with key. */
+};
+
+/**
+ * @brief Hashmap with compile time capacity. All slots are stored inline,
+ *        there are no memory allocations. Collisions are resolved by
+ *        linear probing with robin hood reordering. Elements are removed
+ *        with backward shift deletion, there are no tombstones.
+ * @pre K and V must be default constructible and copy-assignable.
+ *      K must implement operator ==.
+ */
+template <typename K, typename V, std::size_t Capacity,
+          typename HashFn = Hash<K> >
+class StaticHashMap
+{
+    static_assert(Capacity > 0, "StaticHashMap Capacity must not be zero.");
+    static_assert(Capacity <= UINT16_MAX, "StaticHashMap Capacity too large.");
+
+public:
+    // Member Types
+    typedef K KeyType;
+    typedef V MappedType;
+    typedef HashMapEntry<K, V> ValueType;
+    typedef ValueType & Reference;
+    typedef ValueType const & ConstReference;
+    typedef std::size_t SizeType;
+    typedef uint16_t DistanceType;
+    typedef HashMapIterator<ValueType, DistanceType> Iterator;
+    typedef HashMapIterator<ValueType const, DistanceType> ConstIterator;
+    typedef BackwardIterator<Iterator> ReverseIterator;
+    typedef BackwardIterator<ConstIterator> ConstReverseIterator;
+
+    /**
+     * @brief Default Constructor, creates empty hashmap.
+     * @param[in] hash   Hash function object used on keys.
+     */
+    explicit StaticHashMap(HashFn const & hash = HashFn())
+        : dists_(0)
+        , count_(0)
+        , hash_(hash)
+    {
+    }
+
+    /**
+     * @brief Insert a new key-value pair.
+     * @param[in] key     Reference to the key to insert.
+     * @param[in] value   Reference to the value associated with @p key.
+     * @returns           Zero on success.
+     *                    -EEXIST if @p key is already stored. The stored
+     *                    value is not changed.
+     *                    -ENOMEM if the hashmap is full.
+     */
+    auto insert(KeyType const & key, MappedType const & value) -> int
+    {
+        if (this->lookup_(key) != Capacity) {
+            return -EEXIST;
+        }
+        if (this->full()) {
+            return -ENOMEM;
+        }
+        this->place_(key, value);
+        return 0;
+    }
+
+    /**
+     * @brief Insert a key-value pair or overwrite the value of an
+     *        already stored key.
+     * @param[in] key     Reference to the key to insert.
+     * @param[in] value   Reference to the value associated with @p key.
+     * @returns           Zero on success.
+     *                    -ENOMEM if @p key is not stored and the
+     *                    hashmap is full.
+     */
+    auto assign(KeyType const & key, MappedType const & value) -> int
+    {
+        SizeType pos = this->lookup_(key);
+        if (pos != Capacity) {
+            this->slots_[pos].value = value;
+            return 0;
+        }
+        if (this->full()) {
+            return -ENOMEM;
+        }
+        this->place_(key, value);
+        return 0;
+    }
+
+    /**
+     * @brief Lookup the value associated with @p key.
+     * @param[in] key    Reference to the key to search for.
+     * @param[out] dst   Reference the found value is assigned to.
+     * @returns          Zero if @p key was found.
+     *                   -ENOENT if @p key is not stored. @p dst is unchanged.
+     */
+    auto find(KeyType const & key, MappedType & dst) const -> int
+    {
+        SizeType pos = this->lookup_(key);
+        if (pos == Capacity) {
+            return -ENOENT;
+        }
+        dst = this->slots_[pos].value;
+        return 0;
+    }
+
+    /**
+     * @brief Lookup the entry stored with @p key.
+     * @param[in] key   Reference to the key to search for.
+     * @returns         Iterator to the entry of @p key. end() if
+     *                  @p key is not stored.
+     */
+    auto find(KeyType const & key) -> Iterator
+    {
+        return this->iteratorAt_(this->lookup_(key));
+    }
+
+    /**
+     * @brief Check if @p key is stored.
+     * @param[in] key   Reference to the key to search for.
+     * @returns         true if @p key is stored, false otherwise.
+     */
+    auto contains(KeyType const & key) const -> bool
+    {
+        return this->lookup_(key) != Capacity;
+    }
+
+    /**
+     * @brief Remove the entry stored with @p key.
+     * @param[in] key   Reference to the key to remove.
+     * @returns         Zero if the entry was removed.
+     *                  -ENOENT if @p key is not stored.
+     */
+    auto erase(KeyType const & key) -> int
+    {
+        SizeType pos = this->lookup_(key);
+        if (pos == Capacity) {
+            return -ENOENT;
+        }
+        // Shift following entries back, until an empty slot or an entry
+        // in its home slot is found.
+        SizeType next = this->nextSlot_(pos);
+        while (this->dists_[next] > 1) {
+            this->slots_[pos] = this->slots_[next];
+            this->dists_[pos] = this->dists_[next] - 1;
+            pos = next;
+            next = this->nextSlot_(next);
+        }
+        this->dists_[pos] = 0;
+        this->count_ -= 1;
+        return 0;
+    }
+
+    /**
+     * @brief Remove all entries.
+     */
+    auto clear() -> void
+    {
+        this->dists_.fill(0);
+        this->count_ = 0;
+    }
+
+    /**
+     * @brief Number of stored entries.
+     * @returns   Number of entries.
+     */
+    auto size() const -> SizeType
+    {
+        return this->count_;
+    }
+
+    /**
+     * @brief Maximum number of storable entries.
+     *        Always the value of the third template parameter.
+     * @returns   Hashmap capacity.
+     */
+    auto capacity() const -> SizeType
+    {
+        return Capacity;
+    }
+
+    /**
+     * @brief Check if hashmap is empty.
+     * @returns   true if hashmap contains no entries.
+     */
+    auto empty() const -> bool
+    {
+        return this->count_ == 0;
+    }
+
+    /**
+     * @brief Check if hashmap is full.
+     * @returns   true if no further keys can be inserted.
+     */
+    auto full() const -> bool
+    {
+        return this->count_ == Capacity;
+    }
+
+    /**
+     * @brief Returns a forward iterator pointing to the first stored entry.
+     * @note Iteration order is the slot order, not the insertion order.
+     * @returns   Iterator to first entry.
+     */
+    auto begin() -> Iterator
+    {
+        return ++(this->iteratorAt_(SizeType(-1)));
+    }
+
+    /**
+     * @brief Returns a forward iterator pointing to the past-the-end slot.
+     *        Do not dereference.
+     * @returns   Iterator past the last slot.
+     */
+    auto end() -> Iterator
+    {
+        return this->iteratorAt_(Capacity);
+    }
+
+    /**
+     * @brief Returns a reverse iterator pointing to the last stored entry.
+     * @returns   Reverse iterator to the last entry.
+     */
+    auto rbegin() -> ReverseIterator
+    {
+        return ReverseIterator(--(this->iteratorAt_(Capacity)));
+    }
+
+    /**
+     * @brief Returns a reverse iterator pointing to the past-the-first slot.
+     *        Do not dereference.
+     * @returns   Reverse iterator before the first slot.
+     */
+    auto rend() -> ReverseIterator
+    {
+        return ReverseIterator(this->iteratorAt_(SizeType(-1)));
+    }
+
+    /**
+     * @brief Returns a const forward iterator pointing to the first
+     *        stored entry.
+     * @returns   Const iterator to first entry.
+     */
+    auto cbegin() const -> ConstIterator
+    {
+        return ++(this->constIteratorAt_(SizeType(-1)));
+    }
+
+    /**
+     * @brief Returns a const forward iterator pointing to the past-the-end
+     *        slot. Do not dereference.
+     * @returns   Const iterator past the last slot.
+     */
+    auto cend() const -> ConstIterator
+    {
+        return this->constIteratorAt_(Capacity);
+    }
+
+    /**
+     * @brief Returns a const reverse iterator pointing to the last
+     *        stored entry.
+     * @returns   Const reverse iterator to the last entry.
+     */
+    auto crbegin() const -> ConstReverseIterator
+    {
+        return ConstReverseIterator(--(this->constIteratorAt_(Capacity)));
+    }
+
+    /**
+     * @brief Returns a const reverse iterator pointing to the past-the-first
+     *        slot. Do not dereference.
+     * @returns   Const reverse iterator before the first slot.
+     */
+    auto crend() const -> ConstReverseIterator
+    {
+        return ConstReverseIterator(this->constIteratorAt_(SizeType(-1)));
+    }
+
+private:
+    /**
+     * @brief Calculate home slot of @p key.
+     * @param[in] key   Reference to key.
+     * @returns         Index of the home slot.
+     */
+    auto homeSlot_(KeyType const & key) const -> SizeType
+    {
+        return this->hash_(key) % Capacity;
+    }
+
+    /**
+     * @brief Calculate slot following @p pos.
+     * @param[in] pos   Slot index.
+     * @returns         Index of the next slot, wraps around.
+     */
+    auto nextSlot_(SizeType pos) const -> SizeType
+    {
+        pos += 1;
+        return (pos == Capacity) ? 0 : pos;
+    }
+
+    /**
+     * @brief Search the slot containing @p key.
+     * @note The search stops as soon as an entry closer to its home
+     *       slot than @p key would be is found.
+     * @param[in] key   Reference to the key to search for.
+     * @returns         Index of the slot containing @p key.
+     *                  Capacity if @p key is not stored.
+     */
+    auto lookup_(KeyType const & key) const -> SizeType
+    {
+        SizeType pos = this->homeSlot_(key);
+        DistanceType dist = 1;
+        while (dist <= this->dists_[pos]) {
+            if (this->dists_[pos] == dist && this->slots_[pos].key == key) {
+                return pos;
+            }
+            pos = this->nextSlot_(pos);
+            dist += 1;
+        }
+        return Capacity;
+    }
+
+    /**
+     * @brief Place a new entry.
+     * @note Internal function. @p key must not be stored and the
+     *       hashmap must not be full.
+     * @param[in] key     Reference to the key to insert.
+     * @param[in] value   Reference to the value associated with @p key.
+     */
+    auto place_(KeyType const & key, MappedType const & value) -> void
+    {
+        ValueType entry;
+        entry.key = key;
+        entry.value = value;
+        SizeType pos = this->homeSlot_(key);
+        DistanceType dist = 1;
+        while (this->dists_[pos] != 0) {
+            // Take the slot from entries closer to their home slot.
+            if (this->dists_[pos] < dist) {
+                ValueType tmpEntry = this->slots_[pos];
+                DistanceType tmpDist = this->dists_[pos];
+                this->slots_[pos] = entry;
+                this->dists_[pos] = dist;
+                entry = tmpEntry;
+                dist = tmpDist;
+            }
+            pos = this->nextSlot_(pos);
+            dist += 1;
+        }
+        this->slots_[pos] = entry;
+        this->dists_[pos] = dist;
+        this->count_ += 1;
+    }
+
+    /**
+     * @brief Construct Iterator pointing to slot @p pos.
+     * @param[in] pos   Slot index.
+     * @returns         Iterator to slot @p pos.
+     */
+    auto iteratorAt_(SizeType pos) -> Iterator
+    {
+        return Iterator(this->slots_.data(), this->dists_.data(), Capacity, pos);
+    }
+
+    /**
+     * @brief Construct ConstIterator pointing to slot @p pos.
+     * @param[in] pos   Slot index.
+     * @returns         ConstIterator to slot @p pos.
+     */
+    auto constIteratorAt_(SizeType pos) const -> ConstIterator
+    {
+        return ConstIterator(this->slots_.data(), this->dists_.data(), Capacity, pos);
+    }
+
+    Array<ValueType, Capacity> slots_;      /**< Slot storage */
+    Array<DistanceType, Capacity> dists_;   /**< Probe distance + 1 per slot, zero if empty */
+    SizeType count_;                        /**< Number of stored entries */
+    HashFn hash_;                           /**< Hash function object */
+};
+
+} // namespace riot
+#endif // STATICHASHMAP_IMPL_HPP
@@ -0,0 +1,428 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Fixed memory histogram with log-linear buckets.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef HISTOGRAM_IMPL_HPP
+#define HISTOGRAM_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "../array.hpp"
+
+namespace riot
+{
+
+namespace keepout
+{
+
+// Write @p value as LEB128 varint. Returns bytes written, zero if @p len is too small.
+inline auto histogramPutVarint(uint8_t * buf, std::size_t len, uint64_t value) -> std::size_t
+{
+    std::size_t n = 0;
+    do {
+        if (n == len) {
+            return 0;
+        }
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        buf[n++] = byte | ((value != 0) ? 0x80 : 0x00);
+    } while (value != 0);
+    return n;
+}
+
+// Read LEB128 varint into @p value. Returns bytes read, zero on truncated input.
+inline auto histogramGetVarint(uint8_t const * buf, std::size_t len, uint64_t & value) -> std::size_t
+{
+    value = 0;
+    for (std::size_t n = 0; n < len && n < 10; ++n) {
+        value |= static_cast<uint64_t>(buf[n] & 0x7F) << (7 * n);
+        if ((buf[n] & 0x80) == 0) {
+            return n + 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace keepout
+
+/**
+ * @brief Histogram with @p Buckets log-linear buckets (HDR style).
+ *        Values below 2^SubBucketBits have a bucket each. Every following
+ *        power of two range is split into 2^SubBucketBits linear buckets,
+ *        the relative error of a bucket is below 2^-SubBucketBits.
+ *        Values beyond the last bucket are counted in the last bucket.
+ * @note Recording is O(1), memory is fixed to @p Buckets counters.
+ */
+template <std::size_t Buckets, std::size_t SubBucketBits = 2>
+class Histogram
+{
+    static_assert(Buckets > 0, "Histogram Buckets must not be zero.");
+    static_assert(Buckets <= UINT16_MAX, "Histogram Buckets must fit into 16 bit.");
+    static_assert(SubBucketBits < 16, "Histogram SubBucketBits must be less than 16.");
+
+public:
+    // Member Types
+    typedef uint32_t CountType;
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Default Constructor. Creates empty histogram.
+     */
+    Histogram()
+    {
+        this->reset();
+    }
+
+    /**
+     * @brief Record @p value @p n times.
+     * @param[in] value   Value to record.
+     * @param[in] n       Number of occurrences.
+     */
+    auto record(uint64_t const value, CountType const n = 1) -> void
+    {
+        this->counts_[bucket(value)] += n;
+        this->samples_ += n;
+        if (value < this->min_) {
+            this->min_ = value;
+        }
+        if (value > this->max_) {
+            this->max_ = value;
+        }
+    }
+
+    /**
+     * @brief Add all values recorded in @p other.
+     * @param[in] other   Histogram to merge into this histogram.
+     */
+    auto merge(Histogram const & other) -> void
+    {
+        for (SizeType i = 0; i < Buckets; ++i) {
+            this->counts_[i] += other.counts_[i];
+        }
+        this->samples_ += other.samples_;
+        if (other.min_ < this->min_) {
+            this->min_ = other.min_;
+        }
+        if (other.max_ > this->max_) {
+            this->max_ = other.max_;
+        }
+    }
+
+    /**
+     * @brief Remove all recorded values.
+     */
+    auto reset() -> void
+    {
+        this->counts_.fill(0);
+        this->samples_ = 0;
+        this->min_ = UINT64_MAX;
+        this->max_ = 0;
+    }
+
+    /**
+     * @brief Value below which @p perMille per mille of the recorded values are.
+     * @note The result is the upper bound of the bucket containing the value,
+     *       limited to max().
+     * @param[in] perMille   Quantile in per mille (500: median, 990: p99).
+     * @returns   Value at quantile. Zero if histogram is empty.
+     */
+    auto quantile(uint32_t const perMille) const -> uint64_t
+    {
+        if (this->samples_ == 0) {
+            return 0;
+        }
+        if (perMille == 0) {
+            return this->min_;
+        }
+        uint64_t target = (this->samples_ * ((perMille < 1000) ? perMille : 1000) + 999) / 1000;
+        uint64_t acc = 0;
+        for (SizeType i = 0; i < Buckets; ++i) {
+            acc += this->counts_[i];
+            if (acc >= target) {
+                uint64_t upper = upperBound(i);
+                return (upper < this->max_) ? upper : this->max_;
+            }
+        }
+        return this->max_;
+    }
+
+    /**
+     * @brief Number of values recorded in bucket @p bucket.
+     * @param[in] bucket   Bucket index.
+     * @returns   Count of @p bucket. Zero if @p bucket is out of range.
+     */
+    auto count(SizeType const bucket) const -> CountType
+    {
+        return (bucket < Buckets) ? this->counts_[bucket] : 0;
+    }
+
+    /**
+     * @brief Number of recorded values.
+     * @returns   Number of recorded values.
+     */
+    auto samples() const -> uint64_t
+    {
+        return this->samples_;
+    }
+
+    /**
+     * @brief Smallest recorded value.
+     * @returns   Smallest recorded value. Zero if histogram is empty.
+     */
+    auto min() const -> uint64_t
+    {
+        return (this->samples_ != 0) ? this->min_ : 0;
+    }
+
+    /**
+     * @brief Largest recorded value.
+     * @returns   Largest recorded value. Zero if histogram is empty.
+     */
+    auto max() const -> uint64_t
+    {
+        return this->max_;
+    }
+
+    /**
+     * @brief Number of buckets.
+     * @returns   Buckets.
+     */
+    static constexpr auto buckets() -> SizeType
+    {
+        return Buckets;
+    }
+
+    /**
+     * @brief Bucket a value is counted in.
+     * @param[in] value   Value to map.
+     * @returns   Bucket index.
+     */
+    static auto bucket(uint64_t const value) -> SizeType
+    {
+        SizeType idx = value;
+        if (value >= SubBuckets) {
+            SizeType shift = (63 - __builtin_clzll(value)) - SubBucketBits;
+            idx = shift * SubBuckets + static_cast<SizeType>(value >> shift);
+        }
+        return (idx < Buckets) ? idx : Buckets - 1;
+    }
+
+    /**
+     * @brief Smallest value counted in bucket @p bucket.
+     * @param[in] bucket   Bucket index.
+     * @returns   Lower bound of @p bucket. UINT64_MAX if no 64-bit value
+     *            maps to @p bucket.
+     */
+    static auto lowerBound(SizeType const bucket) -> uint64_t
+    {
+        if (bucket < SubBuckets) {
+            return bucket;
+        }
+        SizeType shift = bucket / SubBuckets - 1;
+        if (shift > 63 - SubBucketBits) {
+            return UINT64_MAX;
+        }
+        return static_cast<uint64_t>(bucket % SubBuckets + SubBuckets) << shift;
+    }
+
+    /**
+     * @brief Largest value counted in bucket @p bucket.
+     * @param[in] bucket   Bucket index.
+     * @returns   Upper bound of @p bucket. UINT64_MAX for the last bucket.
+     */
+    static auto upperBound(SizeType const bucket) -> uint64_t
+    {
+        if (bucket + 1 >= Buckets || lowerBound(bucket + 1) == UINT64_MAX) {
+            return UINT64_MAX;
+        }
+        return lowerBound(bucket + 1) - 1;
+    }
+
+    /**
+     * @brief Maximum size of the serialized histogram.
+     * @returns   Buffer size needed by serialize() in the worst case.
+     */
+    static constexpr auto maxSerializedSize() -> SizeType
+    {
+        // Header, three 64-bit varints, entry count and (gap, count) per bucket.
+        return HeaderSize + 3 * 10 + 3 + Buckets * (3 + 5);
+    }
+
+    /**
+     * @brief Serialize histogram into @p buf. Only non-empty buckets are stored.
+     * @note Format: 'H', version, SubBucketBits, Buckets (16 bit little endian),
+     *       followed by LEB128 varints: samples, min, max, number of non-empty
+     *       buckets and for each of them the index distance to the previous
+     *       non-empty bucket and its count.
+     * @param[out] buf   Buffer to serialize into.
+     * @param[in] len    Size of @p buf.
+     * @returns   Number of bytes written on success.
+     *            -ENOBUFS if @p buf is too small.
+     */
+    auto serialize(uint8_t * buf, SizeType const len) const -> int
+    {
+        if (len < HeaderSize) {
+            return -ENOBUFS;
+        }
+        buf[0] = Magic;
+        buf[1] = Version;
+        buf[2] = SubBucketBits;
+        buf[3] = Buckets & 0xFF;
+        buf[4] = (Buckets >> 8) & 0xFF;
+        SizeType pos = HeaderSize;
+
+        SizeType entries = 0;
+        for (SizeType i = 0; i < Buckets; ++i) {
+            entries += (this->counts_[i] != 0) ? 1 : 0;
+        }
+        uint64_t const fields[] = {this->samples_, this->min(), this->max_, entries};
+        for (SizeType i = 0; i < sizeof(fields) / sizeof(fields[0]); ++i) {
+            SizeType n = keepout::histogramPutVarint(buf + pos, len - pos, fields[i]);
+            if (n == 0) {
+                return -ENOBUFS;
+            }
+            pos += n;
+        }
+
+        SizeType prev = 0;
+        for (SizeType i = 0; i < Buckets; ++i) {
+            if (this->counts_[i] == 0) {
+                continue;
+            }
+            SizeType n = keepout::histogramPutVarint(buf + pos, len - pos, i - prev);
+            if (n == 0) {
+                return -ENOBUFS;
+            }
+            pos += n;
+            n = keepout::histogramPutVarint(buf + pos, len - pos, this->counts_[i]);
+            if (n == 0) {
+                return -ENOBUFS;
+            }
+            pos += n;
+            prev = i;
+        }
+        return pos;
+    }
+
+    /**
+     * @brief Restore histogram from data written by serialize().
+     * @param[in] buf   Serialized histogram.
+     * @param[in] len   Size of @p buf.
+     * @returns   Zero on success.
+     *            -EINVAL if @p buf is truncated, corrupted or was written by a
+     *            histogram with different Buckets or SubBucketBits. The
+     *            histogram is empty afterwards.
+     */
+    auto deserialize(uint8_t const * buf, SizeType const len) -> int
+    {
+        this->reset();
+        if (len < HeaderSize || buf[0] != Magic || buf[1] != Version ||
+            buf[2] != SubBucketBits || (buf[3] | (buf[4] << 8)) != Buckets) {
+            return -EINVAL;
+        }
+        SizeType pos = HeaderSize;
+
+        uint64_t fields[4];
+        for (SizeType i = 0; i < 4; ++i) {
+            SizeType n = keepout::histogramGetVarint(buf + pos, len - pos, fields[i]);
+            if (n == 0) {
+                return -EINVAL;
+            }
+            pos += n;
+        }
+
+        uint64_t idx = 0;
+        uint64_t total = 0;
+        for (uint64_t i = 0; i < fields[3]; ++i) {
+            uint64_t gap;
+            uint64_t cnt;
+            SizeType n = keepout::histogramGetVarint(buf + pos, len - pos, gap);
+            if (n == 0) {
+                this->reset();
+                return -EINVAL;
+            }
+            pos += n;
+            n = keepout::histogramGetVarint(buf + pos, len - pos, cnt);
+            idx += gap;
+            if (n == 0 || idx >= Buckets || cnt > UINT32_MAX) {
+                this->reset();
+                return -EINVAL;
+            }
+            pos += n;
+            this->counts_[idx] = cnt;
+            total += cnt;
+        }
+        if (total != fields[0]) {
+            this->reset();
+            return -EINVAL;
+        }
+        this->samples_ = fields[0];
+        this->min_ = (fields[0] != 0) ? fields[1] : UINT64_MAX;
+        this->max_ = fields[2];
+        return 0;
+    }
+
+private:
+    static constexpr SizeType SubBuckets = static_cast<SizeType>(1) << SubBucketBits;
+    static constexpr SizeType HeaderSize = 5;
+    static constexpr uint8_t Magic = 'H';
+    static constexpr uint8_t Version = 1;
+
+    Array<CountType, Buckets> counts_;
+    uint64_t samples_;
+    uint64_t min_;
+    uint64_t max_;
+};
+
+/**
+ * @brief Equality comparison of two histograms.
+ * @param[in] lhs   Histogram (left hand side).
+ * @param[in] rhs   Histogram (right hand side).
+ * @returns   true if both histograms contain the same counts.
+ */
+template <std::size_t Buckets, std::size_t SubBucketBits>
+auto operator == (Histogram<Buckets, SubBucketBits> const & lhs,
+                  Histogram<Buckets, SubBucketBits> const & rhs) -> bool
+{
+    if (lhs.samples() != rhs.samples() || lhs.min() != rhs.min() || lhs.max() != rhs.max()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < Buckets; ++i) {
+        if (lhs.count(i) != rhs.count(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Inequality comparison of two histograms.
+ * @param[in] lhs   Histogram (left hand side).
+ * @param[in] rhs   Histogram (right hand side).
+ * @returns   true if the histograms differ.
+ */
+template <std::size_t Buckets, std::size_t SubBucketBits>
+auto operator != (Histogram<Buckets, SubBucketBits> const & lhs,
+                  Histogram<Buckets, SubBucketBits> const & rhs) -> bool
+{
+    return !(lhs == rhs);
+}
+
+} // namespace riot
+#endif // HISTOGRAM_IMPL_HPP
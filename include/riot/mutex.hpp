@@ -23,5 +23,7 @@
 
 #include "mutex/mutex_impl.hpp"
 #include "mutex/lockguard_impl.hpp"
+#include "mutex/irqlock_impl.hpp"
+#include "mutex/seqlock_impl.hpp"
 
 #endif // MUTEX_HPP
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Lock disabling interrupts.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef IRQLOCK_IMPL_HPP
+#define IRQLOCK_IMPL_HPP
+
+#include "irq.h"
+
+namespace riot
+{
+
+/**
+ * @brief Lock complying to the LockGuard interface by disabling interrupts.
+ *        unlock() restores the interrupt state saved by lock().
+ * @note Usable in interrupt context. Must not be held across blocking calls.
+ *       Not recursive: Every lock() must be followed by unlock() before the
+ *       next lock().
+ */
+class IrqLock
+{
+public:
+    /**
+     * @brief Default Constructor.
+     */
+    IrqLock()
+        : state_(0)
+    {
+    }
+
+    /**
+     * @brief Disables interrupts and saves the previous state.
+     */
+    auto lock() -> void
+    {
+        this->state_ = irq_disable();
+    }
+
+    /**
+     * @brief Restores the interrupt state saved by lock().
+     */
+    auto unlock() -> void
+    {
+        irq_restore(this->state_);
+    }
+
+private:
+    unsigned state_; /**< Interrupt state before lock() */
+
+    // Deleted with purpose
+    IrqLock(IrqLock const &) = delete;
+    IrqLock(IrqLock const &&) = delete;
+    auto operator = (IrqLock const &) -> IrqLock & = delete;
+    auto operator = (IrqLock const &&) -> IrqLock & = delete;
+};
+
+} // namespace riot
+#endif // IRQLOCK_IMPL_HPP
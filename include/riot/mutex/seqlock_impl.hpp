@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Sequence lock for read-mostly shared values.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef SEQLOCK_IMPL_HPP
+#define SEQLOCK_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "mutex_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Sequence lock protecting a value of type @p T. Readers copy the
+ *        value without locking and retry if a writer interfered. Writers
+ *        are serialized by @p Lock.
+ * @note A writer makes the sequence counter odd while it updates the value.
+ *       Readers copy the value in between two equal, even counter values.
+ * @note Writer side complies to the LockGuard interface:
+ *       LockGuard<SeqLock<T>> g(seqLock); seqLock.value().member = x;
+ * @note read() spins while a write is in progress. A reader preempting the
+ *       writer, e.g. in interrupt context, must use tryRead(), unless the
+ *       writers use IrqLock.
+ * @pre @p T must be trivially copyable. Torn copies are discarded.
+ */
+template <typename T, typename Lock = Mutex>
+class SeqLock
+{
+    static_assert(__is_trivially_copyable(T), "SeqLock requires a trivially copyable T.");
+
+public:
+    // Member Types
+    typedef T ValueType;
+    typedef T & Reference;
+    typedef T const & ConstReference;
+
+    /**
+     * @brief Default Constructor.
+     */
+    SeqLock()
+        : value_()
+        , seq_(0)
+    {
+    }
+
+    /**
+     * @brief Constructor: Initialize protected value.
+     * @param[in] initValue   Initial value.
+     */
+    SeqLock(ConstReference initValue)
+        : value_(initValue)
+        , seq_(0)
+    {
+    }
+
+    /**
+     * @brief Writer: Replace the protected value.
+     * @param[in] src   New value.
+     */
+    auto write(ConstReference src) -> void
+    {
+        this->lock();
+        this->value_ = src;
+        this->unlock();
+    }
+
+    /**
+     * @brief Writer: Aquire the writer lock and start an update.
+     * @note Readers retry until unlock() is called.
+     */
+    auto lock() -> void
+    {
+        this->lock_.lock();
+        __atomic_store_n(&this->seq_, this->seq_ + 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_RELEASE);
+    }
+
+    /**
+     * @brief Writer: Finish the update and release the writer lock.
+     */
+    auto unlock() -> void
+    {
+        __atomic_store_n(&this->seq_, this->seq_ + 1, __ATOMIC_RELEASE);
+        this->lock_.unlock();
+    }
+
+    /**
+     * @brief Writer: Access the protected value for an in place update.
+     * @pre The calling thread holds the writer lock.
+     * @returns   Reference to the protected value.
+     */
+    auto value() -> Reference
+    {
+        return this->value_;
+    }
+
+    /**
+     * @brief Reader: Copy a consistent snapshot of the protected value.
+     * @note Never locks. Retries while writers interfere.
+     * @param[out] dst   Copy of the protected value.
+     */
+    auto read(Reference dst) const -> void
+    {
+        while (this->tryRead(dst) != 0) {
+        }
+    }
+
+    /**
+     * @brief Reader: Try once to copy a consistent snapshot of the protected value.
+     * @param[out] dst   Copy of the protected value. Undefined on failure.
+     * @returns   Zero on success.
+     *            -EAGAIN if a writer interfered.
+     */
+    auto tryRead(Reference dst) const -> int
+    {
+        uint32_t before = __atomic_load_n(&this->seq_, __ATOMIC_ACQUIRE);
+        if (before & 1) {
+            return -EAGAIN;
+        }
+        dst = this->value_;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        uint32_t after = __atomic_load_n(&this->seq_, __ATOMIC_RELAXED);
+        return (before == after) ? 0 : -EAGAIN;
+    }
+
+    /**
+     * @brief Get the sequence counter. Changes with every update.
+     * @returns   Sequence counter. Odd while an update is in progress.
+     */
+    auto sequence() const -> uint32_t
+    {
+        return __atomic_load_n(&this->seq_, __ATOMIC_ACQUIRE);
+    }
+
+    // Deleted with purpose
+    SeqLock(SeqLock const &) = delete;
+    SeqLock(SeqLock const &&) = delete;
+    auto operator = (SeqLock const &) -> SeqLock & = delete;
+    auto operator = (SeqLock const &&) -> SeqLock & = delete;
+
+private:
+    ValueType value_; /**< Protected value */
+    uint32_t seq_;    /**< Sequence counter, odd during updates */
+    Lock lock_;       /**< Lock serializing writers */
+};
+
+} // namespace riot
+#endif // SEQLOCK_IMPL_HPP
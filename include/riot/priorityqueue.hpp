@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef PRIORITYQUEUE_HPP
+#define PRIORITYQUEUE_HPP
+
+/**
+ * @ingroup     riot_cpp_wrapper
+ * @{
+ *
+ * @file
+ * @brief       Metaheader including all Header for priority queues.
+ *
+ * @author      Simon Brummer <simon.brummer@posteo.de>
+ *
+ * @}
+ */
+
+#include "priorityqueue/compare_impl.hpp"
+#include "priorityqueue/priorityqueue_impl.hpp"
+
+#endif // PRIORITYQUEUE_HPP
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Comparison function objects.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef COMPARE_IMPL_HPP
+#define COMPARE_IMPL_HPP
+
+namespace riot
+{
+
+/**
+ * @brief Function object performing lhs < rhs.
+ * @pre T must implement operator <.
+ */
+template <typename T>
+class Less
+{
+public:
+    /**
+     * @brief Compare @p lhs and @p rhs.
+     * @param[in] lhs   Leftside of the comparison.
+     * @param[in] rhs   Rightside of the comparison.
+     * @returns         true if @p lhs is less than @p rhs.
+     */
+    auto operator () (T const & lhs, T const & rhs) const -> bool
+    {
+        return lhs < rhs;
+    }
+};
+
+/**
+ * @brief Function object performing lhs > rhs.
+ * @pre T must implement operator >.
+ */
+template <typename T>
+class Greater
+{
+public:
+    /**
+     * @brief Compare @p lhs and @p rhs.
+     * @param[in] lhs   Leftside of the comparison.
+     * @param[in] rhs   Rightside of the comparison.
+     * @returns         true if @p lhs is greater than @p rhs.
+     */
+    auto operator () (T const & lhs, T const & rhs) const -> bool
+    {
+        return lhs > rhs;
+    }
+};
+
+} // namespace riot
+#endif // COMPARE_IMPL_HPP
@@ -0,0 +1,378 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Fixed capacity priority queue based on a d-ary heap.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef PRIORITYQUEUE_IMPL_HPP
+#define PRIORITYQUEUE_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "../array.hpp"
+#include "compare_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Priority queue with compile time capacity.
+ * @note The element @p a for which Compare(a, b) holds against every other
+ *       element @p b is on top. With the default Compare (Less) the
+ *       smallest element is on top (min-heap).
+ * @note Every stored element is identified by a Handle. Handles stay
+ *       valid until the element is removed and can be used to change
+ *       the priority of an element. The heap itself only moves handles,
+ *       elements are never moved after push().
+ * @pre T must be default constructible and copy-assignable.
+ */
+template <typename T, std::size_t Capacity, typename Compare = Less<T>,
+          std::size_t Arity = 2>
+class PriorityQueue
+{
+    static_assert(Capacity > 0, "PriorityQueue Capacity must not be zero.");
+    static_assert(Capacity <= UINT16_MAX, "PriorityQueue Capacity too large.");
+    static_assert(Arity >= 2, "PriorityQueue Arity must be at least two.");
+
+public:
+    // Member Types
+    typedef T ValueType;
+    typedef T & Reference;
+    typedef T const & ConstReference;
+    typedef std::size_t SizeType;
+    typedef uint16_t Handle;
+
+    /**
+     * @brief Default Constructor, creates empty priority queue.
+     * @param[in] comp   Compare function object.
+     */
+    explicit PriorityQueue(Compare const & comp = Compare())
+        : count_(0)
+        , comp_(comp)
+    {
+        this->clear();
+    }
+
+    /**
+     * @brief Add an element to the priority queue.
+     * @param[in] value   Reference to object to add.
+     * @returns           Zero on success.
+     *                    -ENOMEM if the priority queue is full.
+     */
+    auto push(ConstReference value) -> int
+    {
+        Handle handle;
+        return this->push(value, handle);
+    }
+
+    /**
+     * @brief Add an element to the priority queue.
+     * @param[in] value     Reference to object to add.
+     * @param[out] handle   Handle of the added element.
+     * @returns             Zero on success.
+     *                      -ENOMEM if the priority queue is full.
+     *                      @p handle is unchanged.
+     */
+    auto push(ConstReference value, Handle & handle) -> int
+    {
+        if (this->full()) {
+            return -ENOMEM;
+        }
+        // First unused handle is stored behind the last heap entry.
+        handle = this->heap_[this->count_];
+        this->values_[handle] = value;
+        this->count_ += 1;
+        this->siftUp_(this->count_ - 1);
+        return 0;
+    }
+
+    /**
+     * @brief Access the top element.
+     * @pre Priority queue must not be empty.
+     * @returns   Const reference to the top element.
+     */
+    auto top() const -> ConstReference
+    {
+        return this->values_[this->heap_[0]];
+    }
+
+    /**
+     * @brief Copy the top element.
+     * @param[out] dst   Reference the top element is assigned to.
+     * @returns          Zero on success.
+     *                   -ENOENT if the priority queue is empty.
+     */
+    auto top(Reference dst) const -> int
+    {
+        if (this->empty()) {
+            return -ENOENT;
+        }
+        dst = this->top();
+        return 0;
+    }
+
+    /**
+     * @brief Remove the top element.
+     * @param[out] dst   Reference the removed element is assigned to.
+     * @returns          Zero on success.
+     *                   -ENOENT if the priority queue is empty.
+     */
+    auto pop(Reference dst) -> int
+    {
+        if (this->empty()) {
+            return -ENOENT;
+        }
+        dst = this->top();
+        this->removeAt_(0);
+        return 0;
+    }
+
+    /**
+     * @brief Remove the top element.
+     * @returns   Zero on success.
+     *            -ENOENT if the priority queue is empty.
+     */
+    auto pop() -> int
+    {
+        if (this->empty()) {
+            return -ENOENT;
+        }
+        this->removeAt_(0);
+        return 0;
+    }
+
+    /**
+     * @brief Replace the element identified by @p handle. The heap is
+     *        restored in O(log n), regardless if priority increased or
+     *        decreased.
+     * @param[in] handle   Handle of the element to update.
+     * @param[in] value    Reference to the new value.
+     * @returns            Zero on success.
+     *                     -EINVAL if @p handle is not in use.
+     */
+    auto update(Handle const handle, ConstReference value) -> int
+    {
+        if (!this->contains(handle)) {
+            return -EINVAL;
+        }
+        this->values_[handle] = value;
+        SizeType pos = this->pos_[handle];
+        if (pos > 0 && this->before_(pos, parent_(pos))) {
+            this->siftUp_(pos);
+        } else {
+            this->siftDown_(pos);
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Remove the element identified by @p handle.
+     * @param[in] handle   Handle of the element to remove.
+     * @returns            Zero on success.
+     *                     -EINVAL if @p handle is not in use.
+     */
+    auto erase(Handle const handle) -> int
+    {
+        if (!this->contains(handle)) {
+            return -EINVAL;
+        }
+        this->removeAt_(this->pos_[handle]);
+        return 0;
+    }
+
+    /**
+     * @brief Access the element identified by @p handle.
+     * @pre @p handle must be in use.
+     * @param[in] handle   Handle of the element.
+     * @returns            Const reference to the element.
+     */
+    auto get(Handle const handle) const -> ConstReference
+    {
+        return this->values_[handle];
+    }
+
+    /**
+     * @brief Check if @p handle identifies a stored element.
+     * @param[in] handle   Handle to check.
+     * @returns            true if @p handle is in use.
+     */
+    auto contains(Handle const handle) const -> bool
+    {
+        return (handle < Capacity) && (this->pos_[handle] < this->count_);
+    }
+
+    /**
+     * @brief Remove all elements. All handles become invalid.
+     */
+    auto clear() -> void
+    {
+        for (SizeType i = 0; i < Capacity; ++i) {
+            this->heap_[i] = i;
+            this->pos_[i] = i;
+        }
+        this->count_ = 0;
+    }
+
+    /**
+     * @brief Number of stored elements.
+     * @returns   Number of elements.
+     */
+    auto size() const -> SizeType
+    {
+        return this->count_;
+    }
+
+    /**
+     * @brief Maximum number of storable elements.
+     *        Always the value of the second template parameter.
+     * @returns   Priority queue capacity.
+     */
+    auto capacity() const -> SizeType
+    {
+        return Capacity;
+    }
+
+    /**
+     * @brief Check if priority queue is empty.
+     * @returns   true if the priority queue contains no elements.
+     */
+    auto empty() const -> bool
+    {
+        return this->count_ == 0;
+    }
+
+    /**
+     * @brief Check if priority queue is full.
+     * @returns   true if no further elements can be added.
+     */
+    auto full() const -> bool
+    {
+        return this->count_ == Capacity;
+    }
+
+private:
+    /**
+     * @brief Calculate parent position of heap position @p pos.
+     * @param[in] pos   Heap position, must be greater zero.
+     * @returns         Heap position of the parent.
+     */
+    static auto parent_(SizeType const pos) -> SizeType
+    {
+        return (pos - 1) / Arity;
+    }
+
+    /**
+     * @brief Check if the element at heap position @p lhs must be
+     *        closer to the top than the element at @p rhs.
+     * @param[in] lhs   Heap position.
+     * @param[in] rhs   Heap position.
+     * @returns         true if element at @p lhs is ordered before @p rhs.
+     */
+    auto before_(SizeType const lhs, SizeType const rhs) const -> bool
+    {
+        return this->comp_(this->values_[this->heap_[lhs]],
+                           this->values_[this->heap_[rhs]]);
+    }
+
+    /**
+     * @brief Swap two heap positions and update the position table.
+     * @param[in] lhs   Heap position.
+     * @param[in] rhs   Heap position.
+     */
+    auto swap_(SizeType const lhs, SizeType const rhs) -> void
+    {
+        Handle tmp = this->heap_[lhs];
+        this->heap_[lhs] = this->heap_[rhs];
+        this->heap_[rhs] = tmp;
+        this->pos_[this->heap_[lhs]] = lhs;
+        this->pos_[this->heap_[rhs]] = rhs;
+    }
+
+    /**
+     * @brief Move element at heap position @p pos towards the top.
+     * @param[in] pos   Heap position.
+     */
+    auto siftUp_(SizeType pos) -> void
+    {
+        while (pos > 0) {
+            SizeType parent = parent_(pos);
+            if (!this->before_(pos, parent)) {
+                break;
+            }
+            this->swap_(pos, parent);
+            pos = parent;
+        }
+    }
+
+    /**
+     * @brief Move element at heap position @p pos towards the bottom.
+     * @param[in] pos   Heap position.
+     */
+    auto siftDown_(SizeType pos) -> void
+    {
+        for (;;) {
+            SizeType first = pos * Arity + 1;
+            if (first >= this->count_) {
+                break;
+            }
+            SizeType last = first + Arity;
+            if (last > this->count_) {
+                last = this->count_;
+            }
+            SizeType best = first;
+            for (SizeType child = first + 1; child < last; ++child) {
+                if (this->before_(child, best)) {
+                    best = child;
+                }
+            }
+            if (!this->before_(best, pos)) {
+                break;
+            }
+            this->swap_(pos, best);
+            pos = best;
+        }
+    }
+
+    /**
+     * @brief Remove element at heap position @p pos.
+     * @note The handle of the removed element is moved behind the
+     *       last heap entry and is reused on the next push().
+     * @param[in] pos   Heap position.
+     */
+    auto removeAt_(SizeType const pos) -> void
+    {
+        SizeType last = this->count_ - 1;
+        this->swap_(pos, last);
+        this->count_ -= 1;
+        if (pos < this->count_) {
+            if (pos > 0 && this->before_(pos, parent_(pos))) {
+                this->siftUp_(pos);
+            } else {
+                this->siftDown_(pos);
+            }
+        }
+    }
+
+    Array<ValueType, Capacity> values_;   /**< Element storage, indexed by handle */
+    Array<Handle, Capacity> heap_;        /**< Heap of handles, followed by unused handles */
+    Array<Handle, Capacity> pos_;         /**< Heap position per handle */
+    SizeType count_;                      /**< Number of stored elements */
+    Compare comp_;                        /**< Compare function object */
+};
+
+} // namespace riot
+#endif // PRIORITYQUEUE_IMPL_HPP
@@ -21,8 +21,18 @@
  * @}
  */
 
+#include "ringbuffer/ringbufferstats_impl.hpp"
 #include "ringbuffer/ringbuffer_impl.hpp"
 #include "ringbuffer/lockedringbuffer_impl.hpp"
+#include "ringbuffer/latencytrace_impl.hpp"
 #include "ringbuffer/blockingringbuffer_impl.hpp"
+#include "ringbuffer/recordringbuffer_impl.hpp"
+#include "ringbuffer/lockedrecordringbuffer_impl.hpp"
+#include "ringbuffer/blockingrecordringbuffer_impl.hpp"
+#include "ringbuffer/bipbuffer_impl.hpp"
+#include "ringbuffer/broadcastringbuffer_impl.hpp"
+#include "ringbuffer/priorityblockingringbuffer_impl.hpp"
+#include "ringbuffer/windowaggregates_impl.hpp"
+#include "ringbuffer/windowedringbuffer_impl.hpp"
 
 #endif // RINGBUFFER_HPP
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Bipartite circular buffer with contiguous reservations.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef BIPBUFFER_IMPL_HPP
+#define BIPBUFFER_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "ringbuffer_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Circular buffer storing up to @p Size elements of type @p T inline.
+ *        Writers reserve and readers access contiguous blocks, e.g. for DMA.
+ * @note Elements are kept in two regions: Region A is read from. Region B
+ *       starts at the beginning of the storage and is written to as soon
+ *       as the space behind region A is too small for a reservation. Space
+ *       behind region A is not used until region A is read completely.
+ * @note Writing: reserve() a block, fill it, commit() the filled part.
+ *       Reading: block() the oldest elements, use them, release() them.
+ */
+template <typename T, std::size_t Size>
+class BipBuffer
+{
+public:
+    // Member Types
+    typedef T ValueType;
+    typedef T & Reference;
+    typedef T * Pointer;
+    typedef T const & ConstReference;
+    typedef T const * ConstPointer;
+    typedef std::size_t SizeType;
+    typedef typename keepout::RingbufferIndex<Size>::Type IndexType;
+
+    /**
+     * @brief Default Constructor, creates empty BipBuffer.
+     */
+    BipBuffer()
+        : aStart_(0)
+        , aEnd_(0)
+        , bEnd_(0)
+        , resStart_(0)
+        , resSize_(0)
+    {
+    }
+
+    /**
+     * @brief Reserve @p n contiguous elements for writing.
+     * @note Only one reservation can be pending. Reserved elements are
+     *       not readable until they are committed.
+     * @param[in] n      Number of elements to reserve.
+     * @param[out] dst   Pointer to the first reserved element.
+     * @returns          Zero on success.
+     *                   -EINVAL if @p n is zero.
+     *                   -EBUSY if a reservation is pending.
+     *                   -ENOMEM if no contiguous block of @p n elements is free.
+     */
+    auto reserve(SizeType const n, Pointer & dst) -> int
+    {
+        if (n == 0) {
+            return -EINVAL;
+        }
+        if (this->resSize_ != 0) {
+            return -EBUSY;
+        }
+        SizeType start = 0;
+        if (this->bEnd_ != 0) {
+            // Region B in use: Grow B towards the start of region A.
+            if (n > SizeType(this->aStart_ - this->bEnd_)) {
+                return -ENOMEM;
+            }
+            start = this->bEnd_;
+        } else if (n <= Size - this->aEnd_) {
+            // Grow region A towards the end of the storage.
+            start = this->aEnd_;
+        } else if (n <= this->aStart_) {
+            // Start region B in front of region A.
+            start = 0;
+        } else {
+            return -ENOMEM;
+        }
+        this->resStart_ = start;
+        this->resSize_ = n;
+        dst = this->mem_ + start;
+        return 0;
+    }
+
+    /**
+     * @brief Make the first @p n elements of the pending reservation readable
+     *        and end the reservation.
+     * @param[in] n   Number of written elements. Zero cancels the reservation.
+     * @returns       Zero on success.
+     *                -EINVAL if no reservation is pending or @p n exceeds it.
+     */
+    auto commit(SizeType const n) -> int
+    {
+        if (this->resSize_ == 0 || n > this->resSize_) {
+            return -EINVAL;
+        }
+        if (n != 0) {
+            if (this->aStart_ == this->aEnd_) {
+                // Empty buffer: Reservation becomes region A.
+                this->aStart_ = this->resStart_;
+                this->aEnd_ = this->resStart_ + n;
+            } else if (this->resStart_ == this->aEnd_) {
+                this->aEnd_ += n;
+            } else {
+                this->bEnd_ += n;
+            }
+        }
+        this->resSize_ = 0;
+        return 0;
+    }
+
+    /**
+     * @brief Access the oldest contiguous block of readable elements.
+     * @param[out] src   Pointer to the oldest element.
+     * @returns          Number of elements in the block. Zero if empty.
+     */
+    auto block(ConstPointer & src) const -> SizeType
+    {
+        src = this->mem_ + this->aStart_;
+        return this->aEnd_ - this->aStart_;
+    }
+
+    /**
+     * @brief Remove up to @p n elements of the block returned by block().
+     * @param[in] n   Number of elements to remove.
+     * @returns       Number of removed elements.
+     */
+    auto release(SizeType const n) -> SizeType
+    {
+        SizeType avail = this->aEnd_ - this->aStart_;
+        SizeType removed = (n < avail) ? n : avail;
+        this->aStart_ += removed;
+        if (this->aStart_ == this->aEnd_) {
+            // Region A is read completely: Region B becomes region A.
+            this->aStart_ = 0;
+            this->aEnd_ = this->bEnd_;
+            this->bEnd_ = 0;
+        }
+        return removed;
+    }
+
+    /**
+     * @brief Copy @p n elements into the BipBuffer.
+     * @note Either all or none of the elements are added.
+     * @param[in] src   Array of elements to add.
+     * @param[in] n     Number of elements in @p src.
+     * @returns         Zero on success.
+     *                  -EINVAL if @p n is zero.
+     *                  -EBUSY if a reservation is pending.
+     *                  -ENOMEM if no contiguous block of @p n elements is free.
+     */
+    auto add(ValueType const src[], SizeType const n) -> int
+    {
+        Pointer dst = nullptr;
+        int err = this->reserve(n, dst);
+        if (err) {
+            return err;
+        }
+        for (SizeType i = 0; i < n; ++i) {
+            dst[i] = src[i];
+        }
+        return this->commit(n);
+    }
+
+    /**
+     * @brief Take up to @p n of the oldest elements.
+     * @param[out] dst   Array to store elements.
+     * @param[in] n      Maximum number of elements to store in @p dst.
+     * @returns          Number of taken elements.
+     */
+    auto get(ValueType dst[], SizeType const n) -> SizeType
+    {
+        SizeType taken = 0;
+        ConstPointer src = nullptr;
+        SizeType avail = this->block(src);
+        while (taken < n && avail != 0) {
+            SizeType chunk = (n - taken < avail) ? n - taken : avail;
+            for (SizeType i = 0; i < chunk; ++i) {
+                dst[taken + i] = src[i];
+            }
+            taken += this->release(chunk);
+            avail = this->block(src);
+        }
+        return taken;
+    }
+
+    /**
+     * @brief Number of stored elements, excluding a pending reservation.
+     * @returns   Stored elements.
+     */
+    auto size() const -> SizeType
+    {
+        return (this->aEnd_ - this->aStart_) + this->bEnd_;
+    }
+
+    /**
+     * @brief Number of elements not in use.
+     * @note Not all free elements may be reservable at once. See contiguousFree().
+     * @returns   Free places in BipBuffer.
+     */
+    auto getFree() const -> SizeType
+    {
+        return Size - this->size();
+    }
+
+    /**
+     * @brief Size of the largest block reserve() currently accepts.
+     * @returns   Largest contiguous free block.
+     */
+    auto contiguousFree() const -> SizeType
+    {
+        if (this->bEnd_ != 0) {
+            return this->aStart_ - this->bEnd_;
+        }
+        SizeType tail = Size - this->aEnd_;
+        return (tail < this->aStart_) ? this->aStart_ : tail;
+    }
+
+    /**
+     * @brief Check if BipBuffer is empty.
+     * @returns   non-zero if BipBuffer is empty.
+     *            zero if BipBuffer contains elements.
+     */
+    auto empty() const -> int
+    {
+        return this->aStart_ == this->aEnd_;
+    }
+
+    /**
+     * @brief Check if BipBuffer is full.
+     * @returns   non-zero if no element can be reserved.
+     *            zero if at least one element can be reserved.
+     */
+    auto full() const -> int
+    {
+        return this->contiguousFree() == 0;
+    }
+
+    /**
+     * @brief Remove all elements and a pending reservation.
+     */
+    auto clear() -> void
+    {
+        this->aStart_ = 0;
+        this->aEnd_ = 0;
+        this->bEnd_ = 0;
+        this->resSize_ = 0;
+    }
+
+    // Deleted with purpose: Pointers handed out by reserve() and block()
+    // must not be shared between copies.
+    BipBuffer(BipBuffer const &) = delete;
+    BipBuffer(BipBuffer const &&) = delete;
+    auto operator = (BipBuffer const &) -> BipBuffer & = delete;
+    auto operator = (BipBuffer const &&) -> BipBuffer & = delete;
+
+private:
+    ValueType mem_[Size]; /**< Memory used for both regions */
+    IndexType aStart_;    /**< Index of the oldest element in region A */
+    IndexType aEnd_;      /**< End of region A */
+    IndexType bEnd_;      /**< End of region B, zero if region B is unused */
+    IndexType resStart_;  /**< Index of the pending reservation */
+    IndexType resSize_;   /**< Size of the pending reservation, zero if none */
+};
+
+} // namespace riot
+#endif // BIPBUFFER_IMPL_HPP
@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Threadsafe RecordRingbuffer with blocking queue semantics.
+  *              Requires 'sema' and 'xtimer' Module.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef BLOCKINGRECORDRINGBUFFER_IMPL_HPP
+#define BLOCKINGRECORDRINGBUFFER_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "xtimer.h"
+#include "../mutex.hpp"
+#include "../semaphore/semaphore_impl.hpp"
+#include "recordringbuffer_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Threadsafe RecordRingbuffer with blocking queue semantics.
+ * @note Readers wait for records. Writers wait until their record fits.
+ *       Every removed record wakes all waiting writers, which retry in
+ *       order of the semaphore. A large record may wait while smaller
+ *       records of other writers pass.
+ */
+template <std::size_t Bytes, typename Buffer = RecordRingbuffer<Bytes>,
+          typename Lock = Mutex, typename Sema = Semaphore>
+class BlockingRecordRingbuffer
+{
+public:
+    // Define Member types
+    typedef std::size_t SizeType;
+    typedef typename Buffer::StatsType StatsType;
+
+    /**
+     * @brief Default Constructor. Create empty ringbuffer.
+     */
+    BlockingRecordRingbuffer()
+        : waitingWriters_(0)
+        , readerSema_(0)
+        , writerSema_(0)
+    {
+    }
+
+    /**
+     * @brief Store record in blocking ringbuffer.
+     * @note Blocks until the record fits into the ringbuffer.
+     * @param[in] src   Record to store.
+     * @param[in] len   Length of @p src in bytes.
+     * @returns   Zero on success.
+     *            -EINVAL if @p len exceeds maxRecordSize().
+     *            -EOVERFLOW if reader semaphore overflowed.
+     *            -ECANCELED if calling thread was blocked while blocking
+     *            ringbuffer is destroyed.
+     */
+    auto putRecord(void const * src, SizeType const len) -> int
+    {
+        if (len > maxRecordSize()) {
+            return -EINVAL;
+        }
+        for (;;) {
+            int err = this->tryPut_(src, len);
+            if (err != -EAGAIN) {
+                return err;
+            }
+            // Wait for a reader to remove a record.
+            err = this->writerSema_.wait();
+            if (err) {
+                // Semaphore was destroyed.
+                return err;
+            }
+        }
+    }
+
+    /**
+     * @brief Try to store record in ringbuffer (non-blocking).
+     * @param[in] src   Record to store.
+     * @param[in] len   Length of @p src in bytes.
+     * @returns   Zero on success.
+     *            -EINVAL if @p len exceeds maxRecordSize().
+     *            -EAGAIN if the record does not fit. Record was not stored.
+     *            -EOVERFLOW if reader semaphore overflowed.
+     */
+    auto tryPutRecord(void const * src, SizeType const len) -> int
+    {
+        if (len > maxRecordSize()) {
+            return -EINVAL;
+        }
+        this->lock_.lock();
+        int err = this->buffer_.putRecord(src, len);
+        this->lock_.unlock();
+        if (err) {
+            // Record does not fit.
+            return -EAGAIN;
+        }
+
+        // Post reader semaphore. Now there are records in ringbuffer.
+        return this->readerSema_.post();
+    }
+
+    /**
+     * @brief Store record in ringbuffer. Blocks until the record fits or
+     *        a timeout expired.
+     * @param[in] src       Record to store.
+     * @param[in] len       Length of @p src in bytes.
+     * @param[in] timeout   Timeout duration in microseconds.
+     * @returns   Zero on success.
+     *            -EINVAL if @p len exceeds maxRecordSize().
+     *            -ETIMEDOUT if timeout expired after @p timeout.
+     *            -EOVERFLOW if reader semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto putRecordTimed(void const * src, SizeType const len, uint64_t const timeout) -> int
+    {
+        if (len > maxRecordSize()) {
+            return -EINVAL;
+        }
+        uint64_t const deadline = xtimer_now_usec64() + timeout;
+        for (;;) {
+            int err = this->tryPut_(src, len);
+            if (err != -EAGAIN) {
+                return err;
+            }
+            uint64_t const now = xtimer_now_usec64();
+            if (now >= deadline) {
+                return -ETIMEDOUT;
+            }
+            // Wait for a reader to remove a record.
+            err = this->writerSema_.waitTimed(deadline - now);
+            if (err) {
+                // Wait operation timed out or semaphore was destroyed.
+                return err;
+            }
+        }
+    }
+
+    /**
+     * @brief Take oldest record from ringbuffer.
+     * @note Blocks if ringbuffer is empty until a record is stored.
+     * @param[out] dst   Buffer to store the record.
+     * @param[in] cap    Size of @p dst.
+     * @returns   Length of the record in bytes on success.
+     *            -ENOBUFS if @p cap is too small. The record is kept.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if calling thread was blocked while blocking
+     *            ringbuffer is destroyed.
+     */
+    auto getRecord(void * dst, SizeType const cap) -> int
+    {
+        // Aquire reader semaphore
+        int err = this->readerSema_.wait();
+        if (err) {
+            // Semaphore was destroyed.
+            return err;
+        }
+        return this->get_(dst, cap);
+    }
+
+    /**
+     * @brief Try to take oldest record from ringbuffer (non-blocking).
+     * @param[out] dst   Buffer to store the record.
+     * @param[in] cap    Size of @p dst.
+     * @returns   Length of the record in bytes on success.
+     *            -EAGAIN if ringbuffer is empty.
+     *            -ENOBUFS if @p cap is too small. The record is kept.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto tryGetRecord(void * dst, SizeType const cap) -> int
+    {
+        // Try to aquire reader semaphore
+        int err = this->readerSema_.tryWait();
+        if (err) {
+            // Semaphore could not be aquired or semaphore was destroyed.
+            return err;
+        }
+        return this->get_(dst, cap);
+    }
+
+    /**
+     * @brief Take oldest record from ringbuffer. Blocks until the ringbuffer
+     *        contains a record or a timeout expired.
+     * @param[out] dst      Buffer to store the record.
+     * @param[in] cap       Size of @p dst.
+     * @param[in] timeout   Timeout duration in microseconds.
+     * @returns   Length of the record in bytes on success.
+     *            -ETIMEDOUT if timeout expired after @p timeout.
+     *            -ENOBUFS if @p cap is too small. The record is kept.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto getRecordTimed(void * dst, SizeType const cap, uint64_t const timeout) -> int
+    {
+        // Aquire reader semaphore. Blocks if buffer is empty
+        int err = this->readerSema_.waitTimed(timeout);
+        if (err) {
+            // Wait operation timed out or semaphore was destroyed.
+            return err;
+        }
+        return this->get_(dst, cap);
+    }
+
+    /**
+     * @brief Get length of the oldest record (non-blocking).
+     * @returns   Length of the oldest record in bytes.
+     *            -EAGAIN if the ringbuffer is empty.
+     */
+    auto peekRecordSize() const -> int
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->buffer_.peekRecordSize();
+    }
+
+    /**
+     * @brief Number of bytes currently unused, including length prefixes.
+     * @returns   Free bytes in BlockingRecordRingbuffer.
+     */
+    auto getFree() const -> SizeType
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->buffer_.getFree();
+    }
+
+    /**
+     * @brief Number of stored records.
+     * @returns   Stored records.
+     */
+    auto records() const -> SizeType
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->buffer_.records();
+    }
+
+    /**
+     * @brief Check if BlockingRecordRingbuffer is empty.
+     * @returns   non-zero if BlockingRecordRingbuffer is empty.
+     *            zero if BlockingRecordRingbuffer contains records.
+     */
+    auto empty() const -> int
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->buffer_.empty();
+    }
+
+    /**
+     * @brief Maximum length of a single record.
+     * @returns   Storage size minus length prefix.
+     */
+    static constexpr auto maxRecordSize() -> SizeType
+    {
+        return Buffer::maxRecordSize();
+    }
+
+    /**
+     * @brief Get statistics recorded by the underlying buffer.
+     * @note Enable statistics with Buffer = RecordRingbuffer<Bytes, RingbufferStats>.
+     * @returns   Consistent copy of the statistics.
+     */
+    auto stats() const -> StatsType
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->buffer_.stats();
+    }
+
+    /**
+     * @brief Reset statistics recorded by the underlying buffer.
+     */
+    auto resetStats() -> void
+    {
+        LockGuard<Lock> g(this->lock_);
+        this->buffer_.resetStats();
+    }
+
+private:
+    /**
+     * @brief Store record if it fits, register as waiting writer otherwise.
+     * @returns   Zero on success.
+     *            -EAGAIN if the record does not fit.
+     *            -EOVERFLOW if reader semaphore overflowed.
+     */
+    auto tryPut_(void const * src, SizeType const len) -> int
+    {
+        this->lock_.lock();
+        if (!this->buffer_.fits(len)) {
+            this->waitingWriters_ += 1;
+            this->lock_.unlock();
+            return -EAGAIN;
+        }
+        this->buffer_.putRecord(src, len);
+        this->lock_.unlock();
+
+        // Post reader semaphore. Now there are records in ringbuffer.
+        return this->readerSema_.post();
+    }
+
+    /**
+     * @brief Take oldest record after the reader semaphore was aquired.
+     * @returns   Length of the record in bytes on success.
+     *            -ENOBUFS if @p cap is too small.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     */
+    auto get_(void * dst, SizeType const cap) -> int
+    {
+        this->lock_.lock();
+        int len = this->buffer_.getRecord(dst, cap);
+        if (len < 0) {
+            // Record is kept: Hand reader semaphore back.
+            this->lock_.unlock();
+            this->readerSema_.post();
+            return len;
+        }
+        SizeType waiting = this->waitingWriters_;
+        this->waitingWriters_ = 0;
+        this->lock_.unlock();
+
+        // Post writer semaphore for each waiting writer. Now there is space in ringbuffer.
+        for (SizeType i = 0; i < waiting; ++i) {
+            int err = this->writerSema_.post();
+            if (err) {
+                // Semaphore overflowed.
+                return err;
+            }
+        }
+        return len;
+    }
+
+    Buffer buffer_;           /**< RecordRingbuffer implementation */
+    mutable Lock lock_;       /**< Mutex to synchronize access to buffer_ */
+    SizeType waitingWriters_; /**< Writers waiting for free space */
+    Sema readerSema_;         /**< Reader Semaphore, counts records */
+    Sema writerSema_;         /**< Writer Semaphore, signals removed records */
+
+    // Deleted on purpose
+    BlockingRecordRingbuffer(BlockingRecordRingbuffer const &) = delete;
+    BlockingRecordRingbuffer(BlockingRecordRingbuffer const &&) = delete;
+    auto operator = (BlockingRecordRingbuffer const &) -> BlockingRecordRingbuffer & = delete;
+    auto operator = (BlockingRecordRingbuffer const &&) -> BlockingRecordRingbuffer & = delete;
+};
+
+} // namespace riot
+#endif // BLOCKINGRECORDRINGBUFFER_IMPL_HPP
@@ -24,16 +24,195 @@
 #define BLOCKINGRINGBUFFER_IMPL_HPP
 
 #include <initializer_list>
+#include <cerrno>
 #include "../mutex.hpp"
+#include "../mutex/lockdummy_impl.hpp"
 #include "../semaphore/semaphore_impl.hpp"
+#include "../semaphore/watchablesemaphore_impl.hpp"
 #include "ringbuffer_impl.hpp"
+#include "latencytrace_impl.hpp"
+#include "wakepolicy_impl.hpp"
 
 namespace riot
 {
 
+namespace keepout
+{
+
+/**
+ * @brief Value is true if @p A and @p B are the same type.
+ */
+template <typename A, typename B>
+class SameType
+{
+public:
+    static constexpr bool Value = false;
+};
+
+template <typename A>
+class SameType<A, A>
+{
+public:
+    static constexpr bool Value = true;
+};
+
+/**
+ * @brief Value is true if BlockingRingbuffer can hand elements directly to a
+ *        waiting reader.
+ * @note Hand-off bypasses statistics, latency trace and wake-up policy, so it
+ *       is disabled if one of them observes the elements. It also requires
+ *       that writers check for a registered reader under a lock protecting
+ *       the ringbuffer storage.
+ */
+template <typename Buffer, typename Lock, typename Trace, typename Wake>
+class HandOffEnabled
+{
+public:
+    static constexpr bool Value = SameType<typename Buffer::StatsType, RingbufferNoStats>::Value &&
+                                  SameType<Trace, NoLatencyTrace>::Value &&
+                                  SameType<Wake, WakeEach>::Value &&
+                                  !SameType<Lock, LockDummy>::Value;
+};
+
+/**
+ * @brief Reader hand-off state of BlockingRingbuffer, selected by @p Enabled.
+ *        Disabled, it is an empty base: No reader registers, no writer finds
+ *        a registered reader.
+ */
+template <bool Enabled, typename T, typename Sema>
+class HandOffState
+{
+protected:
+    auto handOffPending() const -> bool
+    {
+        return false;
+    }
+
+    auto handOffClaim() -> T *
+    {
+        return nullptr;
+    }
+
+    auto handOffRegister(T *) -> bool
+    {
+        return false;
+    }
+
+    auto handOffPost() -> void
+    {
+    }
+
+    auto handOffWait(bool const, uint64_t const) -> int
+    {
+        return -EAGAIN;
+    }
+};
+
+template <typename T, typename Sema>
+class HandOffState<true, T, Sema>
+{
+protected:
+    HandOffState()
+        : handOffSema_(0)
+        , handOffDst_(nullptr)
+        , handOffBusy_(false)
+    {
+    }
+
+    /**
+     * @brief true if a reader registered its destination.
+     */
+    auto handOffPending() const -> bool
+    {
+        return __atomic_load_n(&this->handOffDst_, __ATOMIC_RELAXED) != nullptr;
+    }
+
+    /**
+     * @brief Take the registered destination. Writers and a timed out reader
+     *        compete for it, exactly one of them gets it.
+     * @returns   Registered destination. nullptr if there is none.
+     */
+    auto handOffClaim() -> T *
+    {
+        return __atomic_exchange_n(&this->handOffDst_, nullptr, __ATOMIC_ACQ_REL);
+    }
+
+    /**
+     * @brief Register @p dst as destination of the calling reader.
+     * @note Called under the lock of the owner, while its storage is empty.
+     * @returns   true if registered. false if another reader waits.
+     */
+    auto handOffRegister(T * dst) -> bool
+    {
+        if (__atomic_load_n(&this->handOffBusy_, __ATOMIC_ACQUIRE)) {
+            return false;
+        }
+        __atomic_store_n(&this->handOffBusy_, true, __ATOMIC_RELAXED);
+        __atomic_store_n(&this->handOffDst_, dst, __ATOMIC_RELAXED);
+        return true;
+    }
+
+    /**
+     * @brief Wake the reader after the claimed destination was written.
+     */
+    auto handOffPost() -> void
+    {
+        this->handOffSema_.post();
+    }
+
+    /**
+     * @brief Wait for a writer after handOffRegister() succeeded.
+     * @returns   Zero if an element was handed over.
+     *            -ETIMEDOUT if @p timed and timeout expired after @p timeout.
+     *            -ECANCELED if the semaphore was destroyed.
+     */
+    auto handOffWait(bool const timed, uint64_t const timeout) -> int
+    {
+        int err = (timed) ? this->handOffSema_.waitTimed(timeout) : this->handOffSema_.wait();
+        if (err == -ETIMEDOUT) {
+            if (this->handOffClaim() == nullptr) {
+                // A writer took the registration and is about to post.
+                err = this->handOffSema_.wait();
+            }
+        }
+
+        // Release hand-off to the next reader. Until now, no other reader
+        // could register and consume the post meant for this one.
+        __atomic_store_n(&this->handOffBusy_, false, __ATOMIC_RELEASE);
+        return err;
+    }
+
+private:
+    Sema handOffSema_; /**< Posted after an element was handed over */
+    T * handOffDst_;   /**< Destination of the reader waiting for a hand-off */
+    bool handOffBusy_; /**< A reader waits for a hand-off */
+};
+
+} // namespace keepout
+
+/**
+ * @brief Threadsafe ringbuffer with blocking queue semantics.
+ * @note @p Trace is the latency tracing policy (NoLatencyTrace or
+ *       LatencyTrace<Size>). LatencyTrace records the time each element
+ *       spent in the ringbuffer and requires 'xtimer' Module.
+ * @note @p Wake is the reader wake-up policy (WakeEach or
+ *       WakeCoalesced<Threshold, Delay>). WakeCoalesced hands added elements
+ *       to the readers in batches and requires 'xtimer' Module.
+ * @note A reader blocking in get() or getTimed() on an empty ringbuffer
+ *       registers its destination. The next writer copies its element
+ *       directly into it and wakes the reader, bypassing ringbuffer storage
+ *       and semaphores. One reader at a time waits for a hand-off, other
+ *       readers block as usual. The hand-off is only enabled if nothing
+ *       observes the ringbuffer storage: RingbufferNoStats, NoLatencyTrace,
+ *       WakeEach and a Lock other than keepout::LockDummy.
+ */
 template <typename T, std::size_t Size, typename Buffer = Ringbuffer<T, Size>,
-          typename Lock = Mutex, typename Sema = Semaphore>
+          typename Lock = Mutex, typename Sema = Semaphore,
+          typename Trace = NoLatencyTrace, typename Wake = WakeEach>
 class BlockingRingbuffer
+    : private Trace
+    , private Wake
+    , private keepout::HandOffState<keepout::HandOffEnabled<Buffer, Lock, Trace, Wake>::Value, T, Sema>
 {
 public:
     // Define Member types
@@ -41,6 +220,8 @@ public:
     typedef T & Reference;
     typedef T const & ConstReference;
     typedef std::size_t SizeType;
+    typedef typename Buffer::StatsType StatsType;
+    typedef typename Trace::HistogramType HistogramType;
 
     /**
      * @brief Default Constructor. Create empty ringbuffer.
@@ -91,6 +272,16 @@ public:
     {
     }
 
+    /**
+     * @brief Destructor.
+     * @note Stops the wake-up policy before the semaphores are destroyed,
+     *       so that its timer can't post them afterwards.
+     */
+    ~BlockingRingbuffer()
+    {
+        this->wakeStop();
+    }
+
     /**
      * @brief Add element to blocking ringbuffer.
      * @note Blocks if ringbuffer is full until an element has been removed
@@ -103,6 +294,10 @@ public:
      */
     auto add(ConstReference src) -> int
     {
+        if (this->handOff_(src)) {
+            return 0;
+        }
+
         // Aquire writer semaphore
         int err = this->writerSema_.wait();
         if (err) {
@@ -110,18 +305,7 @@ public:
             return err;
         }
 
-        // Add Element. Semaphore usage ensures that putOne can't fail.
-        this->lock_.lock();
-        this->buffer_.putOne(src);
-        this->lock_.unlock();
-
-        // Post reader semaphore. Now there are elements in ringbuffer.
-        err = this->readerSema_.post();
-        if (err) {
-            // Semaphore overflowed.
-            return err;
-        }
-        return 0;
+        return this->put_(src);
     }
 
     /**
@@ -136,8 +320,16 @@ public:
      */
     auto get(Reference dst) -> int
     {
-        // Aquire reader semaphore
-        int err = this->readerSema_.wait();
+        // Aquire reader semaphore. If the ringbuffer is empty, wait for a
+        // writer handing an element over directly.
+        int err = this->readerSema_.tryWait();
+        if (err == -EAGAIN) {
+            err = this->awaitHandOff_(dst, false, 0);
+            if (err != -EAGAIN) {
+                return err;
+            }
+            err = this->readerSema_.wait();
+        }
         if (err) {
             // Semaphore was destroyed.
             return err;
@@ -146,6 +338,7 @@ public:
         // Get Element from ringbuffer
         this->lock_.lock();
         this->buffer_.getOne(dst);
+        this->onGet();
         this->lock_.unlock();
 
         // Post writer semaphore. Now there is space in ringbuffer
@@ -167,6 +360,10 @@ public:
      */
     auto tryAdd(ConstReference src) -> int
     {
+        if (this->handOff_(src)) {
+            return 0;
+        }
+
         // Try to aquire writer semaphore.
         int err = this->writerSema_.tryWait();
         if (err) {
@@ -174,18 +371,7 @@ public:
             return err;
         }
 
-        // Add Element. Semaphore usage ensures that putOne can't fail.
-        this->lock_.lock();
-        this->buffer_.putOne(src);
-        this->lock_.unlock();
-
-        // Post reader semaphore. Now there are elements in ringbuffer
-        err = this->readerSema_.post();
-        if (err) {
-            // Semaphore overflowed.
-            return err;
-        }
-        return 0;
+        return this->put_(src);
     }
 
     /**
@@ -209,6 +395,7 @@ public:
         // Get Element from ringbuffer
         this->lock_.lock();
         this->buffer_.getOne(dst);
+        this->onGet();
         this->lock_.unlock();
 
         // Post writer semaphore. Now there is space in ringbuffer
@@ -232,6 +419,10 @@ public:
      */
     auto addTimed(ConstReference src, uint64_t const timeout) -> int
     {
+        if (this->handOff_(src)) {
+            return 0;
+        }
+
         // Try to aquire writer semaphore. Blocks if buffer is full
         int err = this->writerSema_.waitTimed(timeout);
         if (err) {
@@ -239,18 +430,7 @@ public:
             return err;
         }
 
-        // Add Element. Semaphore usage ensures that putOne can't fail.
-        this->lock_.lock();
-        this->buffer_.putOne(src);
-        this->lock_.unlock();
-
-        // Post reader semaphore. Now there are elements in ringbuffer
-        err = this->readerSema_.post();
-        if (err) {
-            // Semaphore overflowed.
-            return err;
-        }
-        return 0;
+        return this->put_(src);
     }
 
 
@@ -266,8 +446,16 @@ public:
      */
     auto getTimed(Reference dst, uint64_t const timeout) -> int
     {
-        // Aquire reader semaphore. Blocks if buffer is empty
-        int err = this->readerSema_.waitTimed(timeout);
+        // Aquire reader semaphore. If the ringbuffer is empty, wait for a
+        // writer handing an element over directly.
+        int err = this->readerSema_.tryWait();
+        if (err == -EAGAIN) {
+            err = this->awaitHandOff_(dst, true, timeout);
+            if (err != -EAGAIN) {
+                return err;
+            }
+            err = this->readerSema_.waitTimed(timeout);
+        }
         if (err) {
             // Wait operation timed out or semaphore was destroyed.
             return err;
@@ -276,6 +464,7 @@ public:
         // Get Element from ringbuffer
         this->lock_.lock();
         this->buffer_.getOne(dst);
+        this->onGet();
         this->lock_.unlock();
 
         // Post writer semaphore. Now there is space in ringbuffer
@@ -287,6 +476,76 @@ public:
         return 0;
     }
 
+    /**
+     * @brief Get up to @p n oldest elements from ringbuffer. Blocks until the
+     *        ringbuffer contains an element to get or a timeout expired.
+     * @note Takes all elements available to readers, at most @p n, under a
+     *       single lock. If the timeout expires, elements withheld by the
+     *       wake-up policy are handed over and taken instead.
+     * @param[out] dst       Array to store the aquired elements into.
+     * @param[in]  n         Maximum number of elements to store in @p dst.
+     * @param[in]  timeout   Timeout duration in microseconds.
+     * @returns   Number of elements stored in @p dst.
+     *            -EINVAL if @p n is zero.
+     *            -ETIMEDOUT if ringbuffer timeout expired after @timeout.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto getBatchTimed(ValueType dst[], SizeType const n, uint64_t const timeout) -> int
+    {
+        if (n == 0) {
+            return -EINVAL;
+        }
+
+        // Aquire reader semaphore for the first element. Blocks if buffer is empty
+        int err = this->readerSema_.waitTimed(timeout);
+        if (err == -ETIMEDOUT) {
+            // Take whatever arrived, even if the wake-up policy withholds it.
+            this->flush();
+            err = this->readerSema_.tryWait();
+            err = (err == -EAGAIN) ? -ETIMEDOUT : err;
+        }
+        if (err) {
+            // Wait operation timed out or semaphore was destroyed.
+            return err;
+        }
+
+        // Aquire reader semaphore for all further available elements
+        SizeType taken = 1;
+        while (taken < n && this->readerSema_.tryWait() == 0) {
+            taken += 1;
+        }
+
+        // Get Elements from ringbuffer
+        this->lock_.lock();
+        for (SizeType i = 0; i < taken; ++i) {
+            this->buffer_.getOne(dst[i]);
+            this->onGet();
+        }
+        this->lock_.unlock();
+
+        // Post writer semaphore once per element. Now there is space in ringbuffer
+        for (SizeType i = 0; i < taken; ++i) {
+            err = this->writerSema_.post();
+            if (err) {
+                // Semaphore overflowed.
+                return err;
+            }
+        }
+        return static_cast<int>(taken);
+    }
+
+    /**
+     * @brief Hand all elements withheld by the wake-up policy to the readers.
+     * @note Without WakeCoalesced, no elements are withheld.
+     * @returns   Zero on success.
+     *            -EOVERFLOW if reader semaphore overflowed.
+     */
+    auto flush() -> int
+    {
+        return this->postReader_(this->wakeFlush());
+    }
+
     /**
      * @brief Number of elements that fit currently into BlockingRingbuffer.
      * @returns   Free places in BlockingRingbuffer.
@@ -319,7 +578,165 @@ public:
         return this->buffer_.full();
     }
 
+    /**
+     * @brief Register @p w to be notified whenever an element was added or
+     *        removed.
+     * @note Requires Sema = WatchableSemaphore.
+     * @param[in] w   Watch to notify. nullptr removes the watch.
+     */
+    auto watch(SemaphoreWatch * w) -> void
+    {
+        this->readerSema_.watch(w);
+        this->writerSema_.watch(w);
+    }
+
+    /**
+     * @brief Get statistics recorded by the underlying buffer.
+     * @note Enable statistics with Buffer = Ringbuffer<T, Size, RingbufferStats>.
+     * @returns   Consistent copy of the statistics.
+     */
+    auto stats() const -> StatsType
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->buffer_.stats();
+    }
+
+    /**
+     * @brief Reset statistics recorded by the underlying buffer.
+     */
+    auto resetStats() -> void
+    {
+        LockGuard<Lock> g(this->lock_);
+        this->buffer_.resetStats();
+    }
+
+    /**
+     * @brief Get queueing delays recorded by the tracing policy.
+     * @note Enable tracing with Trace = LatencyTrace<Size>. Delays are
+     *       given in microseconds.
+     * @returns   Consistent copy of the latency histogram.
+     */
+    auto latency() const -> HistogramType
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->histogram();
+    }
+
+    /**
+     * @brief Remove all recorded queueing delays.
+     */
+    auto resetLatency() -> void
+    {
+        LockGuard<Lock> g(this->lock_);
+        this->resetHistogram();
+    }
+
 private:
+    /**
+     * @brief Post reader semaphore @p n times.
+     * @note Interrupts are disabled while posting more than one element, a
+     *       woken reader runs after the whole batch is visible to it.
+     */
+    auto postReader_(SizeType const n) -> int
+    {
+        if (n <= 1) {
+            return (n == 1) ? this->readerSema_.post() : 0;
+        }
+        IrqLock irq;
+        LockGuard<IrqLock> guard(irq);
+        for (SizeType i = 0; i < n; ++i) {
+            int err = this->readerSema_.post();
+            if (err) {
+                // Semaphore overflowed.
+                return err;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Add element after the writer semaphore was aquired. Hands it to
+     *        a reader instead, if one waits for a hand-off.
+     */
+    auto put_(ConstReference src) -> int
+    {
+        this->lock_.lock();
+        ValueType * dst = this->handOffClaim();
+        if (dst != nullptr) {
+            this->lock_.unlock();
+            *dst = src;
+            this->handOffPost();
+
+            // Post writer semaphore. The element took no place in ringbuffer
+            return this->writerSema_.post();
+        }
+
+        // Add Element. Semaphore usage ensures that putOne can't fail.
+        this->buffer_.putOne(src);
+        this->onAdd();
+        this->lock_.unlock();
+
+        // Post reader semaphore. Now there are elements in ringbuffer
+        return this->postReader_(this->wakeAdded(&BlockingRingbuffer::flush_, this));
+    }
+
+    /**
+     * @brief Copy @p src directly into the destination of a reader waiting
+     *        for a hand-off, bypassing ringbuffer and semaphores.
+     * @returns   true if the element was handed over.
+     *            false if no reader waits for a hand-off.
+     */
+    auto handOff_(ConstReference src) -> bool
+    {
+        if (!this->handOffPending()) {
+            return false;
+        }
+        ValueType * dst = this->handOffClaim();
+        if (dst == nullptr) {
+            // Another writer or the timed out reader was faster.
+            return false;
+        }
+        *dst = src;
+        this->handOffPost();
+        return true;
+    }
+
+    /**
+     * @brief Register @p dst as hand-off destination and wait for a writer.
+     * @note Only one reader at a time waits for a hand-off, from registration
+     *       until its wait returned. Only possible if the ringbuffer is
+     *       empty, all writers check for the registered destination before
+     *       storing an element.
+     * @returns   Zero if an element was handed over into @p dst.
+     *            -EAGAIN if the hand-off is disabled, the ringbuffer is not
+     *            empty or another reader waits for a hand-off.
+     *            -ETIMEDOUT if @p timed and timeout expired after @p timeout.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto awaitHandOff_(Reference dst, bool const timed, uint64_t const timeout) -> int
+    {
+        if (!HandOff) {
+            return -EAGAIN;
+        }
+        this->lock_.lock();
+        if (!this->buffer_.empty() || !this->handOffRegister(&dst)) {
+            this->lock_.unlock();
+            return -EAGAIN;
+        }
+        this->lock_.unlock();
+        return this->handOffWait(timed, timeout);
+    }
+
+    /**
+     * @brief Timer callback of the wake-up policy.
+     */
+    static auto flush_(void * self) -> void
+    {
+        static_cast<BlockingRingbuffer *>(self)->flush();
+    }
+
+    static constexpr bool HandOff = keepout::HandOffEnabled<Buffer, Lock, Trace, Wake>::Value;
+
     Buffer buffer_;     /**< Ringbuffer implementation */
     mutable Lock lock_; /**< Mutex to synchronize access to buffer_ */
     Sema readerSema_;   /**< Reader Semaphore */
@@ -0,0 +1,475 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Threadsafe ringbuffer delivering each element to several readers.
+  *              Requires 'sema' and 'xtimer' Module.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef BROADCASTRINGBUFFER_IMPL_HPP
+#define BROADCASTRINGBUFFER_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "xtimer.h"
+#include "../mutex.hpp"
+#include "../semaphore/semaphore_impl.hpp"
+#include "ringbuffer_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief BroadcastRingbuffer policy: The writer waits until the slowest
+ *        attached reader took the oldest element.
+ */
+class BroadcastWaitForSlowest
+{
+public:
+    static constexpr bool overwrite = false;
+};
+
+/**
+ * @brief BroadcastRingbuffer policy: The writer never waits. Readers lagging
+ *        @p Size elements behind lose their oldest element.
+ */
+class BroadcastOverwriteSlowest
+{
+public:
+    static constexpr bool overwrite = true;
+};
+
+/**
+ * @brief Threadsafe ringbuffer storing up to @p Size elements of type @p T
+ *        once for up to @p Readers readers.
+ * @note Readers attach() to get a reader id and read through their own
+ *       cursor. Each attached reader gets every element added after attach().
+ *       Detached readers do not hold back the writer.
+ * @note @p Policy selects the behavior if the slowest reader is @p Size
+ *       elements behind: BroadcastWaitForSlowest or BroadcastOverwriteSlowest.
+ * @note Intended for a single writer. Several writers are serialized, but
+ *       may wait in any order.
+ */
+template <typename T, std::size_t Size, std::size_t Readers,
+          typename Policy = BroadcastWaitForSlowest, typename Lock = Mutex,
+          typename Sema = Semaphore>
+class BroadcastRingbuffer
+{
+    static_assert(Size > 0, "BroadcastRingbuffer Size must not be zero.");
+    static_assert(Readers > 0, "BroadcastRingbuffer Readers must not be zero.");
+
+public:
+    // Define Member types
+    typedef T ValueType;
+    typedef T & Reference;
+    typedef T const & ConstReference;
+    typedef std::size_t SizeType;
+    typedef typename keepout::RingbufferIndex<Size>::Type IndexType;
+
+    /**
+     * @brief Default Constructor. Create empty ringbuffer without readers.
+     */
+    BroadcastRingbuffer()
+        : head_(0)
+        , waitingWriters_(0)
+        , writerSema_(0)
+    {
+    }
+
+    /**
+     * @brief Register a reader.
+     * @note The reader gets all elements added afterwards.
+     * @returns   Reader id on success.
+     *            -ENOMEM if @p Readers readers are attached.
+     */
+    auto attach() -> int
+    {
+        LockGuard<Lock> g(this->lock_);
+        for (SizeType i = 0; i < Readers; ++i) {
+            Reader & r = this->reader_[i];
+            if (!r.attached) {
+                r.attached = true;
+                r.pending = 0;
+                r.lost = 0;
+                return static_cast<int>(i);
+            }
+        }
+        return -ENOMEM;
+    }
+
+    /**
+     * @brief Unregister a reader. Its unread elements no longer hold back the writer.
+     * @note A thread blocked in get() or getTimed() of the reader returns
+     *       with -EINVAL.
+     * @param[in] id   Reader id returned by attach().
+     * @returns   Zero on success.
+     *            -EINVAL if @p id is not attached.
+     *            -EOVERFLOW if a semaphore overflowed.
+     */
+    auto detach(int const id) -> int
+    {
+        this->lock_.lock();
+        if (!this->valid_(id)) {
+            this->lock_.unlock();
+            return -EINVAL;
+        }
+        Reader & r = this->reader_[id];
+        r.attached = false;
+        r.pending = 0;
+        bool wake = r.waiting;
+        r.waiting = false;
+        SizeType waiting = this->takeWaitingWriters_();
+        this->lock_.unlock();
+
+        // Post semaphore of a waiting reader. It returns with -EINVAL.
+        int ret = wake ? r.sema.post() : 0;
+        int err = this->wakeWriters_(waiting);
+        return err ? err : ret;
+    }
+
+    /**
+     * @brief Add element for all attached readers.
+     * @note With BroadcastWaitForSlowest: Blocks until the slowest reader
+     *       took an element, if the ringbuffer is full.
+     * @param[in] src   Reference to object to place into ringbuffer.
+     * @returns   Zero on success.
+     *            -EOVERFLOW if a semaphore overflowed.
+     *            -ECANCELED if calling thread was blocked while
+     *            ringbuffer is destroyed.
+     */
+    auto add(ConstReference src) -> int
+    {
+        for (;;) {
+            int err = this->tryAdd_(src, true);
+            if (err != -EAGAIN) {
+                return err;
+            }
+            // Wait for the slowest reader.
+            err = this->writerSema_.wait();
+            if (err) {
+                // Semaphore was destroyed.
+                return err;
+            }
+        }
+    }
+
+    /**
+     * @brief Try to add element for all attached readers (non-blocking).
+     * @param[in] src   Reference to object to place into ringbuffer.
+     * @returns   Zero on success.
+     *            -EAGAIN if the slowest reader is @p Size elements behind.
+     *            Only with BroadcastWaitForSlowest.
+     *            -EOVERFLOW if a semaphore overflowed.
+     */
+    auto tryAdd(ConstReference src) -> int
+    {
+        return this->tryAdd_(src, false);
+    }
+
+    /**
+     * @brief Add element for all attached readers. Blocks until the element
+     *        can be stored or a timeout expired.
+     * @param[in] src       Reference to object to place into ringbuffer.
+     * @param[in] timeout   Timeout duration in microseconds.
+     * @returns   Zero on success.
+     *            -ETIMEDOUT if timeout expired after @p timeout.
+     *            -EOVERFLOW if a semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto addTimed(ConstReference src, uint64_t const timeout) -> int
+    {
+        uint64_t const deadline = xtimer_now_usec64() + timeout;
+        for (;;) {
+            int err = this->tryAdd_(src, true);
+            if (err != -EAGAIN) {
+                return err;
+            }
+            uint64_t const now = xtimer_now_usec64();
+            if (now >= deadline) {
+                return -ETIMEDOUT;
+            }
+            // Wait for the slowest reader.
+            err = this->writerSema_.waitTimed(deadline - now);
+            if (err) {
+                // Wait operation timed out or semaphore was destroyed.
+                return err;
+            }
+        }
+    }
+
+    /**
+     * @brief Get oldest unread element of a reader.
+     * @note Blocks until an element is available.
+     * @param[in] id     Reader id returned by attach().
+     * @param[out] dst   Reference to object there the element is stored into.
+     * @returns   Zero on success.
+     *            -EINVAL if @p id is not attached.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if calling thread was blocked while
+     *            ringbuffer is destroyed.
+     */
+    auto get(int const id, Reference dst) -> int
+    {
+        for (;;) {
+            int err = this->tryGet_(id, dst, true);
+            if (err != -EAGAIN) {
+                return err;
+            }
+            // Wait for the writer.
+            err = this->reader_[id].sema.wait();
+            if (err) {
+                // Semaphore was destroyed.
+                return err;
+            }
+        }
+    }
+
+    /**
+     * @brief Try to get oldest unread element of a reader (non-blocking).
+     * @param[in] id     Reader id returned by attach().
+     * @param[out] dst   Reference to object there the element is stored into.
+     * @returns   Zero on success.
+     *            -EINVAL if @p id is not attached.
+     *            -EAGAIN if the reader has no unread elements.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     */
+    auto tryGet(int const id, Reference dst) -> int
+    {
+        return this->tryGet_(id, dst, false);
+    }
+
+    /**
+     * @brief Get oldest unread element of a reader. Blocks until an element
+     *        is available or a timeout expired.
+     * @param[in] id        Reader id returned by attach().
+     * @param[out] dst      Reference to object there the element is stored into.
+     * @param[in] timeout   Timeout duration in microseconds.
+     * @returns   Zero on success.
+     *            -EINVAL if @p id is not attached.
+     *            -ETIMEDOUT if timeout expired after @p timeout.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto getTimed(int const id, Reference dst, uint64_t const timeout) -> int
+    {
+        uint64_t const deadline = xtimer_now_usec64() + timeout;
+        for (;;) {
+            int err = this->tryGet_(id, dst, true);
+            if (err != -EAGAIN) {
+                return err;
+            }
+            uint64_t const now = xtimer_now_usec64();
+            if (now >= deadline) {
+                return -ETIMEDOUT;
+            }
+            // Wait for the writer.
+            err = this->reader_[id].sema.waitTimed(deadline - now);
+            if (err) {
+                // Wait operation timed out or semaphore was destroyed.
+                return err;
+            }
+        }
+    }
+
+    /**
+     * @brief Number of unread elements of a reader.
+     * @param[in] id   Reader id returned by attach().
+     * @returns   Number of unread elements.
+     *            -EINVAL if @p id is not attached.
+     */
+    auto available(int const id) const -> int
+    {
+        LockGuard<Lock> g(this->lock_);
+        if (!this->valid_(id)) {
+            return -EINVAL;
+        }
+        return this->reader_[id].pending;
+    }
+
+    /**
+     * @brief Number of elements a reader lost, because the writer overwrote
+     *        them. Only with BroadcastOverwriteSlowest.
+     * @param[in] id   Reader id returned by attach().
+     * @returns   Number of lost elements since attach().
+     */
+    auto lost(int const id) const -> uint32_t
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->valid_(id) ? this->reader_[id].lost : 0;
+    }
+
+    /**
+     * @brief Number of elements the writer can add without waiting.
+     * @returns   Free places behind the slowest attached reader.
+     */
+    auto getFree() const -> SizeType
+    {
+        LockGuard<Lock> g(this->lock_);
+        return Size - this->slowest_();
+    }
+
+private:
+    /**
+     * @brief Per reader state.
+     */
+    class Reader
+    {
+    public:
+        Reader()
+            : sema(0)
+            , attached(false)
+            , waiting(false)
+            , pending(0)
+            , lost(0)
+        {
+        }
+
+        Sema sema;         /**< Signals added elements to a waiting reader */
+        bool attached;     /**< Reader id is in use */
+        bool waiting;      /**< Reader waits on sema */
+        IndexType pending; /**< Number of unread elements */
+        uint32_t lost;     /**< Number of overwritten unread elements */
+    };
+
+    auto valid_(int const id) const -> bool
+    {
+        return id >= 0 && static_cast<SizeType>(id) < Readers && this->reader_[id].attached;
+    }
+
+    // Unread elements of the slowest attached reader.
+    auto slowest_() const -> SizeType
+    {
+        SizeType max = 0;
+        for (SizeType i = 0; i < Readers; ++i) {
+            if (this->reader_[i].attached && this->reader_[i].pending > max) {
+                max = this->reader_[i].pending;
+            }
+        }
+        return max;
+    }
+
+    auto takeWaitingWriters_() -> SizeType
+    {
+        SizeType waiting = this->waitingWriters_;
+        this->waitingWriters_ = 0;
+        return waiting;
+    }
+
+    // Post writer semaphore for each waiting writer.
+    auto wakeWriters_(SizeType const waiting) -> int
+    {
+        for (SizeType i = 0; i < waiting; ++i) {
+            int err = this->writerSema_.post();
+            if (err) {
+                // Semaphore overflowed.
+                return err;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Store element if possible, register writer as waiting otherwise.
+     * @returns   Zero on success.
+     *            -EAGAIN if the slowest reader is Size elements behind.
+     *            -EOVERFLOW if a reader semaphore overflowed.
+     */
+    auto tryAdd_(ConstReference src, bool const wait) -> int
+    {
+        this->lock_.lock();
+        if (!Policy::overwrite && this->slowest_() == Size) {
+            this->waitingWriters_ += wait ? 1 : 0;
+            this->lock_.unlock();
+            return -EAGAIN;
+        }
+        this->mem_[this->head_] = src;
+        this->head_ = (this->head_ + 1 == Size) ? 0 : this->head_ + 1;
+
+        bool wake[Readers];
+        for (SizeType i = 0; i < Readers; ++i) {
+            Reader & r = this->reader_[i];
+            wake[i] = r.waiting;
+            r.waiting = false;
+            if (!r.attached) {
+                continue;
+            }
+            if (r.pending == Size) {
+                // Only with BroadcastOverwriteSlowest: Oldest element is gone.
+                r.lost += 1;
+            } else {
+                r.pending += 1;
+            }
+        }
+        this->lock_.unlock();
+
+        // Post semaphores of waiting readers. Now there are elements to read.
+        int ret = 0;
+        for (SizeType i = 0; i < Readers; ++i) {
+            if (wake[i]) {
+                int err = this->reader_[i].sema.post();
+                ret = err ? err : ret;
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * @brief Take element if available, register reader as waiting otherwise.
+     * @returns   Zero on success.
+     *            -EINVAL if @p id is not attached.
+     *            -EAGAIN if the reader has no unread elements.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     */
+    auto tryGet_(int const id, Reference dst, bool const wait) -> int
+    {
+        this->lock_.lock();
+        if (!this->valid_(id)) {
+            this->lock_.unlock();
+            return -EINVAL;
+        }
+        Reader & r = this->reader_[id];
+        if (r.pending == 0) {
+            r.waiting = r.waiting || wait;
+            this->lock_.unlock();
+            return -EAGAIN;
+        }
+        SizeType index = (this->head_ >= r.pending) ? this->head_ - r.pending
+                                                    : this->head_ + Size - r.pending;
+        dst = this->mem_[index];
+        r.pending -= 1;
+        SizeType waiting = this->takeWaitingWriters_();
+        this->lock_.unlock();
+
+        // Now there might be space in ringbuffer.
+        return this->wakeWriters_(waiting);
+    }
+
+    ValueType mem_[Size];       /**< Elements, stored once for all readers */
+    IndexType head_;            /**< Index of the next element to write */
+    SizeType waitingWriters_;   /**< Writers waiting on writerSema_ */
+    Reader reader_[Readers];    /**< Reader cursors */
+    mutable Lock lock_;         /**< Mutex to synchronize access */
+    Sema writerSema_;           /**< Signals read elements to a waiting writer */
+
+    // Deleted on purpose
+    BroadcastRingbuffer(BroadcastRingbuffer const &) = delete;
+    BroadcastRingbuffer(BroadcastRingbuffer const &&) = delete;
+    auto operator = (BroadcastRingbuffer const &) -> BroadcastRingbuffer & = delete;
+    auto operator = (BroadcastRingbuffer const &&) -> BroadcastRingbuffer & = delete;
+};
+
+} // namespace riot
+#endif // BROADCASTRINGBUFFER_IMPL_HPP
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Enqueue-to-dequeue latency tracing policies for BlockingRingbuffer.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef LATENCYTRACE_IMPL_HPP
+#define LATENCYTRACE_IMPL_HPP
+
+#include <cstdint>
+#include "xtimer.h"
+#include "ringbuffer_impl.hpp"
+#include "../histogram/histogram_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Latency histogram with power of two buckets covering 32-bit values.
+ *        Bucket 0 counts zero, bucket i counts values in [2^(i-1), 2^i).
+ */
+typedef Histogram<33, 0> LatencyHistogram;
+
+/**
+ * @brief BlockingRingbuffer tracing policy: No latencies are recorded.
+ * @note Empty class with empty inline hooks.
+ */
+class NoLatencyTrace
+{
+public:
+    typedef LatencyHistogram HistogramType;
+
+    auto onAdd() -> void
+    {
+    }
+
+    auto onGet() -> void
+    {
+    }
+
+    auto histogram() const -> HistogramType
+    {
+        return HistogramType();
+    }
+
+    auto resetHistogram() -> void
+    {
+    }
+};
+
+/**
+ * @brief BlockingRingbuffer tracing policy: Records the enqueue time of each
+ *        of up to @p Size queued elements in microseconds and feeds the queueing
+ *        delay into a histogram of type @p Hist on dequeue.
+ * @note Hooks are called in FIFO order while the ringbuffer lock is held.
+ */
+template <std::size_t Size, typename Hist = LatencyHistogram>
+class LatencyTrace
+{
+public:
+    typedef Hist HistogramType;
+
+    /**
+     * @brief Hook: An element was enqueued.
+     */
+    auto onAdd() -> void
+    {
+        this->stamps_.putOne(xtimer_now_usec());
+    }
+
+    /**
+     * @brief Hook: The oldest element was dequeued.
+     */
+    auto onGet() -> void
+    {
+        uint32_t stamp = 0;
+        if (this->stamps_.getOne(stamp) == 0) {
+            this->histogram_.record(xtimer_now_usec() - stamp);
+        }
+    }
+
+    /**
+     * @brief Get recorded latencies.
+     * @returns   Copy of the latency histogram.
+     */
+    auto histogram() const -> HistogramType
+    {
+        return this->histogram_;
+    }
+
+    /**
+     * @brief Remove all recorded latencies.
+     */
+    auto resetHistogram() -> void
+    {
+        this->histogram_.reset();
+    }
+
+private:
+    Ringbuffer<uint32_t, Size> stamps_;
+    HistogramType histogram_;
+};
+
+} // namespace riot
+#endif // LATENCYTRACE_IMPL_HPP
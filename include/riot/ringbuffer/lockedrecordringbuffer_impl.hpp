@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Threadsafe RecordRingbuffer. All operations are
+  *              synchronized via an internal Lock.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef LOCKEDRECORDRINGBUFFER_IMPL_HPP
+#define LOCKEDRECORDRINGBUFFER_IMPL_HPP
+
+#include "../mutex/mutex_impl.hpp"
+#include "../mutex/lockguard_impl.hpp"
+#include "recordringbuffer_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Threadsafe RecordRingbuffer.
+ * @note frontRecord() hands out a pointer into the storage. It is only safe
+ *       with a single consumer, which removes the record with popRecord()
+ *       after use. Producers never overwrite stored records.
+ */
+template <std::size_t Bytes, typename Buffer = RecordRingbuffer<Bytes>, typename Lock = Mutex>
+class LockedRecordRingbuffer
+{
+public:
+    // Use Membertypes of internal RecordRingbuffer
+    typedef std::size_t SizeType;
+    typedef typename Buffer::StatsType StatsType;
+
+    /**
+     * @brief Default Constructor: Creates empty LockedRecordRingbuffer
+     */
+    LockedRecordRingbuffer()
+    {
+    }
+
+    /**
+     * @brief Synchronized putRecord().
+     * @see Documentation putRecord() of supplied template Buffer.
+     */
+    auto putRecord(void const * src, SizeType const len) -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.putRecord(src, len);
+    }
+
+    /**
+     * @brief Synchronized peekRecordSize().
+     * @see Documentation peekRecordSize() of supplied template Buffer.
+     */
+    auto peekRecordSize() const -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.peekRecordSize();
+    }
+
+    /**
+     * @brief Synchronized getRecord().
+     * @see Documentation getRecord() of supplied template Buffer.
+     */
+    auto getRecord(void * dst, SizeType const cap) -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.getRecord(dst, cap);
+    }
+
+    /**
+     * @brief Synchronized peekRecord().
+     * @see Documentation peekRecord() of supplied template Buffer.
+     */
+    auto peekRecord(void * dst, SizeType const cap) const -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.peekRecord(dst, cap);
+    }
+
+    /**
+     * @brief Synchronized frontRecord().
+     * @see Documentation frontRecord() of supplied template Buffer.
+     */
+    auto frontRecord(void const * & data) const -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.frontRecord(data);
+    }
+
+    /**
+     * @brief Synchronized popRecord().
+     * @see Documentation popRecord() of supplied template Buffer.
+     */
+    auto popRecord() -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.popRecord();
+    }
+
+    /**
+     * @brief Synchronized fits().
+     * @see Documentation fits() of supplied template Buffer.
+     */
+    auto fits(SizeType const len) const -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.fits(len);
+    }
+
+    /**
+     * @brief Synchronized getFree().
+     * @see Documentation getFree() of supplied template Buffer.
+     */
+    auto getFree() const -> SizeType
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.getFree();
+    }
+
+    /**
+     * @brief Synchronized records().
+     * @see Documentation records() of supplied template Buffer.
+     */
+    auto records() const -> SizeType
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.records();
+    }
+
+    /**
+     * @brief Synchronized empty().
+     * @see Documentation empty() of supplied template Buffer.
+     */
+    auto empty() const -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.empty();
+    }
+
+    /**
+     * @brief Maximum length of a single record.
+     * @see Documentation maxRecordSize() of supplied template Buffer.
+     */
+    static constexpr auto maxRecordSize() -> SizeType
+    {
+        return Buffer::maxRecordSize();
+    }
+
+    /**
+     * @brief Synchronized stats(). Returns a consistent copy.
+     * @see Documentation stats() of supplied template Buffer.
+     */
+    auto stats() const -> StatsType
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.stats();
+    }
+
+    /**
+     * @brief Synchronized resetStats().
+     * @see Documentation resetStats() of supplied template Buffer.
+     */
+    auto resetStats() -> void
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        this->buffer_.resetStats();
+    }
+
+    // Deleted with purpose
+    LockedRecordRingbuffer(LockedRecordRingbuffer const &) = delete;
+    LockedRecordRingbuffer(LockedRecordRingbuffer const &&) = delete;
+    auto operator = (LockedRecordRingbuffer const &) -> LockedRecordRingbuffer & = delete;
+    auto operator = (LockedRecordRingbuffer const &&) -> LockedRecordRingbuffer & = delete;
+
+private:
+    Buffer buffer_;
+    mutable Lock lock_;
+};
+
+} // namespace riot
+#endif // LOCKEDRECORDRINGBUFFER_IMPL_HPP
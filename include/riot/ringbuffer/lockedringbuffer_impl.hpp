@@ -52,6 +52,7 @@ public:
     typedef T const & ConstReference;
     typedef T const * ConstPointer;
     typedef std::size_t SizeType;
+    typedef typename Buffer::StatsType StatsType;
 
     /**
      * @brief Default Constructor: Creates empty LockedRingbuffer
@@ -166,7 +167,7 @@ public:
      * @brief Synchronized add().
      * @see Documentation add() of supplied template T.
      */
-    auto add(ValueType src[], SizeType n) -> SizeType
+    auto add(ValueType const src[], SizeType n) -> SizeType
     {
         riot::LockGuard<Lock> guard(this->lock_);
         return this->buffer_.add(src, n);
@@ -192,6 +193,46 @@ public:
         return this->buffer_.peek(dst, n);
     }
 
+    /**
+     * @brief Synchronized write().
+     * @see Documentation write() of supplied template T.
+     */
+    auto write(void const * src, SizeType len) -> SizeType
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.write(src, len);
+    }
+
+    /**
+     * @brief Synchronized read().
+     * @see Documentation read() of supplied template T.
+     */
+    auto read(void * dst, SizeType len) -> SizeType
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.read(dst, len);
+    }
+
+    /**
+     * @brief Synchronized readUntil().
+     * @see Documentation readUntil() of supplied template T.
+     */
+    auto readUntil(void * dst, SizeType const len, ValueType const delimiter) -> int
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.readUntil(dst, len, delimiter);
+    }
+
+    /**
+     * @brief Synchronized skip().
+     * @see Documentation skip() of supplied template T.
+     */
+    auto skip(SizeType const len) -> SizeType
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.skip(len);
+    }
+
     /**
      * @brief Synchronized getFree().
      * @see Documentation getFree() of supplied template T.
@@ -232,6 +273,26 @@ public:
         return this->buffer_.remove(n);
     }
 
+    /**
+     * @brief Synchronized stats(). Returns a consistent copy.
+     * @see Documentation stats() of supplied template T.
+     */
+    auto stats() const -> StatsType
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        return this->buffer_.stats();
+    }
+
+    /**
+     * @brief Synchronized resetStats().
+     * @see Documentation resetStats() of supplied template T.
+     */
+    auto resetStats() -> void
+    {
+        riot::LockGuard<Lock> guard(this->lock_);
+        this->buffer_.resetStats();
+    }
+
 private:
     Buffer buffer_;
     mutable Lock lock_;
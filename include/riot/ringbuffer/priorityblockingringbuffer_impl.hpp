@@ -0,0 +1,336 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Threadsafe ringbuffer with priority levels and blocking queue
+  *              semantics. Requires 'sema' Module.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef PRIORITYBLOCKINGRINGBUFFER_IMPL_HPP
+#define PRIORITYBLOCKINGRINGBUFFER_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "../mutex.hpp"
+#include "../semaphore/semaphore_impl.hpp"
+#include "../bitset/bitset_impl.hpp"
+#include "ringbuffer_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Threadsafe ringbuffer with @p Levels priority levels, each storing
+ *        up to @p SizePerLevel elements of type @p T.
+ * @note Level zero is the highest priority, like RIOT thread priorities.
+ *       Readers always get the oldest element of the highest non-empty
+ *       level and wait on a single semaphore across all levels.
+ * @note Writers choose the level per add and only wait if their level is
+ *       full. A full low priority level never blocks high priority writers.
+ * @note Lower levels starve while higher levels are never empty.
+ */
+template <typename T, std::size_t Levels, std::size_t SizePerLevel,
+          typename Lock = Mutex, typename Sema = Semaphore>
+class PriorityBlockingRingbuffer
+{
+    static_assert(Levels > 0, "PriorityBlockingRingbuffer Levels must not be zero.");
+
+public:
+    // Define Member types
+    typedef T ValueType;
+    typedef T & Reference;
+    typedef T const & ConstReference;
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Default Constructor. Create empty ringbuffer.
+     */
+    PriorityBlockingRingbuffer()
+        : readerSema_(0)
+    {
+    }
+
+    /**
+     * @brief Add element to a level.
+     * @note Blocks if the level is full until an element of the level has
+     *       been removed with a get operation.
+     * @param[in] level   Priority level. Zero is the highest priority.
+     * @param[in] src     Reference to object to place into ringbuffer.
+     * @returns   Zero on success.
+     *            -EINVAL if @p level is out of range.
+     *            -EOVERFLOW if reader semaphore overflowed.
+     *            -ECANCELED if calling thread was blocked while blocking
+     *            ringbuffer is destroyed.
+     */
+    auto add(SizeType const level, ConstReference src) -> int
+    {
+        if (level >= Levels) {
+            return -EINVAL;
+        }
+        // Aquire writer semaphore of the level
+        int err = this->levels_[level].writerSema.wait();
+        if (err) {
+            // Semaphore was destroyed.
+            return err;
+        }
+        return this->put_(level, src);
+    }
+
+    /**
+     * @brief Try to add element to a level (non-blocking).
+     * @param[in] level   Priority level. Zero is the highest priority.
+     * @param[in] src     Reference to object to place into ringbuffer.
+     * @returns   Zero on success.
+     *            -EINVAL if @p level is out of range.
+     *            -EAGAIN if the level is full. Element was not added to buffer.
+     *            -EOVERFLOW if reader semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto tryAdd(SizeType const level, ConstReference src) -> int
+    {
+        if (level >= Levels) {
+            return -EINVAL;
+        }
+        // Try to aquire writer semaphore of the level.
+        int err = this->levels_[level].writerSema.tryWait();
+        if (err) {
+            // Semaphore could not be aquired or semaphore was destroyed.
+            return err;
+        }
+        return this->put_(level, src);
+    }
+
+    /**
+     * @brief Add element to a level. Blocks until the level can store the
+     *        element or a timeout expired.
+     * @param[in] level     Priority level. Zero is the highest priority.
+     * @param[in] src       Reference to object to place into ringbuffer.
+     * @param[in] timeout   Timeout duration in microseconds.
+     * @returns   Zero on success.
+     *            -EINVAL if @p level is out of range.
+     *            -ETIMEDOUT if timeout expired after @p timeout.
+     *            -EOVERFLOW if reader semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto addTimed(SizeType const level, ConstReference src, uint64_t const timeout) -> int
+    {
+        if (level >= Levels) {
+            return -EINVAL;
+        }
+        // Try to aquire writer semaphore of the level. Blocks if level is full
+        int err = this->levels_[level].writerSema.waitTimed(timeout);
+        if (err) {
+            // Wait operation timed out or semaphore was destroyed.
+            return err;
+        }
+        return this->put_(level, src);
+    }
+
+    /**
+     * @brief Get oldest element of the highest non-empty level.
+     * @note Blocks if all levels are empty until an element is added.
+     * @param[out] dst   Reference to object there the aquired element
+     *                   is stored into.
+     * @returns   Zero on success.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if calling thread was blocked while blocking
+     *            ringbuffer is destroyed.
+     */
+    auto get(Reference dst) -> int
+    {
+        // Aquire reader semaphore
+        int err = this->readerSema_.wait();
+        if (err) {
+            // Semaphore was destroyed.
+            return err;
+        }
+        return this->take_(dst, nullptr);
+    }
+
+    /**
+     * @brief Get oldest element of the highest non-empty level.
+     * @note Blocks if all levels are empty until an element is added.
+     * @param[out] dst     Reference to object there the aquired element
+     *                     is stored into.
+     * @param[out] level   Level the element was taken from.
+     * @returns   Zero on success.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if calling thread was blocked while blocking
+     *            ringbuffer is destroyed.
+     */
+    auto get(Reference dst, SizeType & level) -> int
+    {
+        // Aquire reader semaphore
+        int err = this->readerSema_.wait();
+        if (err) {
+            // Semaphore was destroyed.
+            return err;
+        }
+        return this->take_(dst, &level);
+    }
+
+    /**
+     * @brief Try to get oldest element of the highest non-empty level (non-blocking).
+     * @param[out] dst   Reference to object there the aquired element
+     *                   is stored into.
+     * @returns   Zero on success.
+     *            -EAGAIN if all levels are empty.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto tryGet(Reference dst) -> int
+    {
+        // Try to aquire reader semaphore
+        int err = this->readerSema_.tryWait();
+        if (err) {
+            // Semaphore could not be aquired or semaphore was destroyed.
+            return err;
+        }
+        return this->take_(dst, nullptr);
+    }
+
+    /**
+     * @brief Get oldest element of the highest non-empty level. Blocks until
+     *        an element is available or a timeout expired.
+     * @param[out] dst       Reference to object there the aquired element is stored into.
+     * @param[in]  timeout   Timeout duration in microseconds.
+     * @returns   Zero on success.
+     *            -ETIMEDOUT if timeout expired after @p timeout.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     *            -ECANCELED if ringbuffer is destroyed.
+     */
+    auto getTimed(Reference dst, uint64_t const timeout) -> int
+    {
+        // Aquire reader semaphore. Blocks if all levels are empty
+        int err = this->readerSema_.waitTimed(timeout);
+        if (err) {
+            // Wait operation timed out or semaphore was destroyed.
+            return err;
+        }
+        return this->take_(dst, nullptr);
+    }
+
+    /**
+     * @brief Number of elements that fit currently into a level.
+     * @param[in] level   Priority level.
+     * @returns   Free places of @p level. Zero if @p level is out of range.
+     */
+    auto getFree(SizeType const level) const -> SizeType
+    {
+        if (level >= Levels) {
+            return 0;
+        }
+        LockGuard<Lock> g(this->lock_);
+        return this->levels_[level].buffer.getFree();
+    }
+
+    /**
+     * @brief Check if all levels are empty.
+     * @returns   non-zero if PriorityBlockingRingbuffer is empty.
+     *            zero if PriorityBlockingRingbuffer contains elements.
+     */
+    auto empty() const -> int
+    {
+        LockGuard<Lock> g(this->lock_);
+        return this->nonEmpty_.none();
+    }
+
+    /**
+     * @brief Check if a level is full.
+     * @param[in] level   Priority level.
+     * @returns   non-zero if @p level is full or out of range.
+     *            zero if @p level is not full.
+     */
+    auto full(SizeType const level) const -> int
+    {
+        return this->getFree(level) == 0;
+    }
+
+private:
+    /**
+     * @brief Storage and writer semaphore of a priority level.
+     */
+    class Level
+    {
+    public:
+        Level()
+            : writerSema(SizePerLevel)
+        {
+        }
+
+        Ringbuffer<T, SizePerLevel> buffer; /**< Elements of the level */
+        Sema writerSema;                    /**< Writer Semaphore, counts free places */
+    };
+
+    /**
+     * @brief Add element after the writer semaphore of @p level was aquired.
+     */
+    auto put_(SizeType const level, ConstReference src) -> int
+    {
+        // Add Element. Semaphore usage ensures that putOne can't fail.
+        this->lock_.lock();
+        this->levels_[level].buffer.putOne(src);
+        this->nonEmpty_.set(level);
+        this->lock_.unlock();
+
+        // Post reader semaphore. Now there are elements in ringbuffer.
+        return this->readerSema_.post();
+    }
+
+    /**
+     * @brief Take element after the reader semaphore was aquired.
+     * @returns   Zero on success.
+     *            -EAGAIN if all levels are empty.
+     *            -EOVERFLOW if writer semaphore overflowed.
+     */
+    auto take_(Reference dst, SizeType * taken) -> int
+    {
+        // Get Element from the highest non-empty level
+        this->lock_.lock();
+        SizeType level = this->nonEmpty_.findFirst();
+        if (level >= Levels) {
+            // Unreachable: The reader semaphore guarantees a non-empty level.
+            this->lock_.unlock();
+            return -EAGAIN;
+        }
+        Level & l = this->levels_[level];
+        l.buffer.getOne(dst);
+        if (l.buffer.empty()) {
+            this->nonEmpty_.reset(level);
+        }
+        this->lock_.unlock();
+        if (taken != nullptr) {
+            *taken = level;
+        }
+
+        // Post writer semaphore of the level. Now there is space in the level.
+        return l.writerSema.post();
+    }
+
+    Level levels_[Levels];      /**< Priority levels, zero is the highest */
+    Bitset<Levels> nonEmpty_;   /**< Set bit for each non-empty level */
+    mutable Lock lock_;         /**< Mutex to synchronize access to levels_ */
+    Sema readerSema_;           /**< Reader Semaphore, counts all elements */
+
+    // Deleted on purpose
+    PriorityBlockingRingbuffer(PriorityBlockingRingbuffer const &) = delete;
+    PriorityBlockingRingbuffer(PriorityBlockingRingbuffer const &&) = delete;
+    auto operator = (PriorityBlockingRingbuffer const &) -> PriorityBlockingRingbuffer & = delete;
+    auto operator = (PriorityBlockingRingbuffer const &&) -> PriorityBlockingRingbuffer & = delete;
+};
+
+} // namespace riot
+#endif // PRIORITYBLOCKINGRINGBUFFER_IMPL_HPP
@@ -0,0 +1,324 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Ringbuffer storing variable-length records in a byte ring.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef RECORDRINGBUFFER_IMPL_HPP
+#define RECORDRINGBUFFER_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include <cstring>
+#include "ringbufferstats_impl.hpp"
+#include "ringbuffer_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Ringbuffer storing variable-length records in @p Bytes bytes.
+ * @note Each record is stored contiguously behind a length prefix of
+ *       sizeof(IndexType) bytes. Records and prefixes may wrap around the
+ *       end of the storage.
+ * @note @p Stats is the statistics policy (RingbufferNoStats or
+ *       RingbufferStats). Statistics count records, not bytes.
+ */
+template <std::size_t Bytes, typename Stats = RingbufferNoStats>
+class RecordRingbuffer : private Stats
+{
+public:
+    // Member Types
+    typedef std::size_t SizeType;
+    typedef typename keepout::RingbufferIndex<Bytes>::Type IndexType;
+    typedef Stats StatsType;
+
+    static_assert(Bytes > sizeof(IndexType), "RecordRingbuffer Bytes must exceed the length prefix.");
+
+    /**
+     * @brief Default Constructor, creates empty RecordRingbuffer.
+     */
+    RecordRingbuffer()
+        : start_(0)
+        , used_(0)
+        , records_(0)
+    {
+    }
+
+    /**
+     * @brief Store a record, if there is enough space left.
+     * @param[in] src   Record to store.
+     * @param[in] len   Length of @p src in bytes.
+     * @returns         Zero if the record was stored.
+     *                  -EINVAL if @p len exceeds maxRecordSize().
+     *                  -ENOMEM if the free space is too small.
+     */
+    auto putRecord(void const * src, SizeType const len) -> int
+    {
+        if (len > maxRecordSize()) {
+            this->onReject(1);
+            return -EINVAL;
+        }
+        if (!this->fits(len)) {
+            this->onReject(1);
+            return -ENOMEM;
+        }
+        uint8_t prefix[sizeof(IndexType)];
+        for (SizeType i = 0; i < sizeof(IndexType); ++i) {
+            prefix[i] = static_cast<uint8_t>(len >> (8 * i));
+        }
+        SizeType tail = wrap_(this->start_ + this->used_);
+        this->copyIn_(tail, prefix, sizeof(IndexType));
+        this->copyIn_(wrap_(tail + sizeof(IndexType)), src, len);
+        this->used_ += sizeof(IndexType) + len;
+        this->records_ += 1;
+        this->onPut(1, this->records_);
+        return 0;
+    }
+
+    /**
+     * @brief Get length of the oldest record.
+     * @returns   Length of the oldest record in bytes.
+     *            -EAGAIN if the ringbuffer is empty.
+     */
+    auto peekRecordSize() const -> int
+    {
+        if (this->empty()) {
+            return -EAGAIN;
+        }
+        return static_cast<int>(this->headLength_());
+    }
+
+    /**
+     * @brief Take the oldest record.
+     * @param[out] dst   Buffer to store the record.
+     * @param[in] cap    Size of @p dst.
+     * @returns          Length of the record in bytes.
+     *                   -EAGAIN if the ringbuffer is empty.
+     *                   -ENOBUFS if @p cap is too small. The record is kept.
+     */
+    auto getRecord(void * dst, SizeType const cap) -> int
+    {
+        int len = this->peekRecord(dst, cap);
+        if (len >= 0) {
+            this->drop_(len);
+        }
+        return len;
+    }
+
+    /**
+     * @brief Copy the oldest record without removing it.
+     * @param[out] dst   Buffer to store the record.
+     * @param[in] cap    Size of @p dst.
+     * @returns          Length of the record in bytes.
+     *                   -EAGAIN if the ringbuffer is empty.
+     *                   -ENOBUFS if @p cap is too small.
+     */
+    auto peekRecord(void * dst, SizeType const cap) const -> int
+    {
+        if (this->empty()) {
+            return -EAGAIN;
+        }
+        SizeType len = this->headLength_();
+        if (len > cap) {
+            return -ENOBUFS;
+        }
+        this->copyOut_(wrap_(this->start_ + sizeof(IndexType)), dst, len);
+        return static_cast<int>(len);
+    }
+
+    /**
+     * @brief Access the oldest record without copying it.
+     * @note @p data stays valid until the record is removed with popRecord().
+     * @param[out] data   Pointer to the first byte of the record.
+     * @returns           Length of the record in bytes.
+     *                    -EAGAIN if the ringbuffer is empty.
+     *                    -ERANGE if the record wraps around the end of the
+     *                    storage. Use peekRecord() or getRecord() instead.
+     */
+    auto frontRecord(void const * & data) const -> int
+    {
+        if (this->empty()) {
+            return -EAGAIN;
+        }
+        SizeType len = this->headLength_();
+        SizeType pos = wrap_(this->start_ + sizeof(IndexType));
+        if (len > Bytes - pos) {
+            return -ERANGE;
+        }
+        data = this->mem_ + pos;
+        return static_cast<int>(len);
+    }
+
+    /**
+     * @brief Remove the oldest record.
+     * @returns   Length of the removed record in bytes.
+     *            -EAGAIN if the ringbuffer is empty.
+     */
+    auto popRecord() -> int
+    {
+        if (this->empty()) {
+            return -EAGAIN;
+        }
+        SizeType len = this->headLength_();
+        this->drop_(len);
+        return static_cast<int>(len);
+    }
+
+    /**
+     * @brief Check if a record of @p len bytes can currently be stored.
+     * @param[in] len   Length of the record in bytes.
+     * @returns         non-zero if the record fits.
+     *                  zero if the record does not fit.
+     */
+    auto fits(SizeType const len) const -> int
+    {
+        return len <= maxRecordSize() && sizeof(IndexType) + len <= this->getFree();
+    }
+
+    /**
+     * @brief Number of bytes currently unused, including length prefixes.
+     * @returns   Free bytes in RecordRingbuffer.
+     */
+    auto getFree() const -> SizeType
+    {
+        return Bytes - this->used_;
+    }
+
+    /**
+     * @brief Number of stored records.
+     * @returns   Stored records.
+     */
+    auto records() const -> SizeType
+    {
+        return this->records_;
+    }
+
+    /**
+     * @brief Check if ringbuffer is empty.
+     * @returns   non-zero if ringbuffer is empty.
+     *            zero if ringbuffer contains records.
+     */
+    auto empty() const -> int
+    {
+        return this->records_ == 0;
+    }
+
+    /**
+     * @brief Maximum length of a single record.
+     * @returns   Storage size minus length prefix.
+     */
+    static constexpr auto maxRecordSize() -> SizeType
+    {
+        return Bytes - sizeof(IndexType);
+    }
+
+    /**
+     * @brief Access recorded statistics.
+     * @returns   Reference to statistics policy object.
+     */
+    auto stats() const -> StatsType const &
+    {
+        return *this;
+    }
+
+    /**
+     * @brief Reset recorded statistics.
+     */
+    auto resetStats() -> void
+    {
+        Stats::reset();
+    }
+
+private:
+    /**
+     * @brief Map a position in [0, 2 * Bytes) to an index into mem_.
+     * @param[in] pos   Position to map.
+     * @returns         Index into mem_.
+     */
+    static auto wrap_(SizeType const pos) -> SizeType
+    {
+        return (pos >= Bytes) ? pos - Bytes : pos;
+    }
+
+    /**
+     * @brief Copy @p len bytes into mem_ starting at @p pos, wrapping around.
+     */
+    auto copyIn_(SizeType const pos, void const * src, SizeType const len) -> void
+    {
+        if (len == 0) {
+            // Empty records may come without a buffer
+            return;
+        }
+        SizeType first = (len < Bytes - pos) ? len : Bytes - pos;
+        memcpy(this->mem_ + pos, src, first);
+        memcpy(this->mem_, static_cast<uint8_t const *>(src) + first, len - first);
+    }
+
+    /**
+     * @brief Copy @p len bytes from mem_ starting at @p pos, wrapping around.
+     */
+    auto copyOut_(SizeType const pos, void * dst, SizeType const len) const -> void
+    {
+        if (len == 0) {
+            // Empty records may come without a buffer
+            return;
+        }
+        SizeType first = (len < Bytes - pos) ? len : Bytes - pos;
+        memcpy(dst, this->mem_ + pos, first);
+        memcpy(static_cast<uint8_t *>(dst) + first, this->mem_, len - first);
+    }
+
+    /**
+     * @brief Decode length prefix of the oldest record.
+     * @note Internal function, performs no boundry checks.
+     */
+    auto headLength_() const -> SizeType
+    {
+        uint8_t prefix[sizeof(IndexType)];
+        this->copyOut_(this->start_, prefix, sizeof(IndexType));
+        SizeType len = 0;
+        for (SizeType i = 0; i < sizeof(IndexType); ++i) {
+            len |= static_cast<SizeType>(prefix[i]) << (8 * i);
+        }
+        return len;
+    }
+
+    /**
+     * @brief Remove the oldest record of @p len bytes.
+     * @note Internal function, performs no boundry checks.
+     */
+    auto drop_(SizeType const len) -> void
+    {
+        this->start_ = wrap_(this->start_ + sizeof(IndexType) + len);
+        this->used_ -= sizeof(IndexType) + len;
+        this->records_ -= 1;
+        if (this->records_ == 0) {
+            // Restart at the beginning: The next records do not wrap.
+            this->start_ = 0;
+        }
+        this->onGet(1);
+    }
+
+    uint8_t mem_[Bytes]; /**< Memory used for records and length prefixes */
+    IndexType start_;    /**< Index of the oldest length prefix */
+    IndexType used_;     /**< Number of used bytes */
+    IndexType records_;  /**< Number of stored records */
+};
+
+} // namespace riot
+#endif // RECORDRINGBUFFER_IMPL_HPP
@@ -11,7 +11,7 @@
   * @{
   *
   * @file
-  * @brief       Wrapper class for RIOTs ringbuffer implementation wrapper.
+  * @brief       Ringbuffer with inline storage and compact indices.
   *
   * @author      Simon Brummer <simon.brummer@posteo.de>
   *
@@ -24,19 +24,92 @@
 #include <initializer_list>
 #include <cstdint>
 #include <cerrno>
-#include "ringbuffer.h"
+#include <cstring>
+#include "ringbufferstats_impl.hpp"
 
 namespace riot
 {
 
+namespace keepout
+{
+
 /**
- * @brief C++ wrapper for Ringbuffers.
- * @note The wrapped ringbuffer operates on raw memory.
- *       This wrapper tries to avoid the pitfalls that come with
- *       memory operations on c++ objects.
+ * @brief Selects the smallest unsigned type able to hold values up to @p N.
  */
-template <typename T, std::size_t Size>
-class Ringbuffer
+template <std::size_t N, bool Fits8 = (N <= UINT8_MAX), bool Fits16 = (N <= UINT16_MAX),
+          bool Fits32 = (N <= UINT32_MAX)>
+class RingbufferIndex
+{
+public:
+    typedef std::size_t Type;
+};
+
+template <std::size_t N, bool Fits16, bool Fits32>
+class RingbufferIndex<N, true, Fits16, Fits32>
+{
+public:
+    typedef uint8_t Type;
+};
+
+template <std::size_t N, bool Fits32>
+class RingbufferIndex<N, false, true, Fits32>
+{
+public:
+    typedef uint16_t Type;
+};
+
+template <std::size_t N>
+class RingbufferIndex<N, false, false, true>
+{
+public:
+    typedef uint32_t Type;
+};
+
+/**
+ * @brief Marks element types the byte stream interface of Ringbuffer accepts.
+ */
+template <typename T>
+class RingbufferIsByte
+{
+public:
+    static constexpr bool value = false;
+};
+
+template <>
+class RingbufferIsByte<char>
+{
+public:
+    static constexpr bool value = true;
+};
+
+template <>
+class RingbufferIsByte<signed char>
+{
+public:
+    static constexpr bool value = true;
+};
+
+template <>
+class RingbufferIsByte<unsigned char>
+{
+public:
+    static constexpr bool value = true;
+};
+
+} // namespace keepout
+
+/**
+ * @brief Ringbuffer storing up to @p Size elements of type @p T inline.
+ * @note Read position and fill level are stored in the smallest unsigned
+ *       type able to hold @p Size.
+ * @note @p Stats is the statistics policy (RingbufferNoStats or
+ *       RingbufferStats). It is an empty base if no statistics are recorded.
+ * @note Ringbuffers of uint8_t, int8_t and char offer a byte stream
+ *       interface: write(), read(), readUntil() and skip(). It copies
+ *       with at most two memcpy calls.
+ */
+template <typename T, std::size_t Size, typename Stats = RingbufferNoStats>
+class Ringbuffer : private Stats
 {
 public:
     // Member Types
@@ -46,14 +119,16 @@ public:
     typedef T const & ConstReference;
     typedef T const * ConstPointer;
     typedef std::size_t SizeType;
+    typedef typename keepout::RingbufferIndex<Size>::Type IndexType;
+    typedef Stats StatsType;
 
     /**
      * @brief Default Constructor, creates empty Ringbuffer.
      */
     Ringbuffer()
+        : start_(0)
+        , avail_(0)
     {
-        ringbuffer_init(&(this->rbuf_), reinterpret_cast<char *>(this->mem_),
-                        sizeof(ValueType) * Size);
     }
 
     /**
@@ -102,12 +177,13 @@ public:
      * @param[in] other   The ringbuffer to copy.
      */
     Ringbuffer(Ringbuffer const & other)
+        : Stats(other)
+        , start_(other.start_)
+        , avail_(other.avail_)
     {
         for (SizeType i = 0; i < Size; ++i) {
             this->mem_[i] = other.mem_[i];
         }
-        this->rbuf_ = other.rbuf_;
-        this->rbuf_.buf = reinterpret_cast<char *>(this->mem_);
     }
 
     /**
@@ -120,8 +196,9 @@ public:
             for (SizeType i = 0; i < Size; ++i) {
                 this->mem_[i] = rhs.mem_[i];
             }
-            this->rbuf_ = rhs.rbuf_;
-            this->rbuf_.buf = reinterpret_cast<char *>(this->mem_);
+            this->start_ = rhs.start_;
+            this->avail_ = rhs.avail_;
+            Stats::operator = (rhs);
         }
         return *this;
     }
@@ -153,6 +230,7 @@ public:
         int ret = -1;
         if (this->full()) {
             this->getHead_(removed);
+            this->onOverwrite();
             ret = 0;
         }
         this->addTail_(src);
@@ -168,6 +246,7 @@ public:
     auto putOne(ConstReference src) -> int
     {
         if (this->full()) {
+            this->onReject(1);
             return -ENOMEM;
         }
         this->addTail_(src);
@@ -187,6 +266,7 @@ public:
             return -1;
         }
         this->getHead_(dst);
+        this->onGet(1);
         return 0;
     }
 
@@ -201,8 +281,7 @@ public:
         if (this->empty()) {
             return -1;
         }
-        dst = *(reinterpret_cast<ConstPointer>(this->rbuf_.buf +
-                                               this->rbuf_.start));
+        dst = this->mem_[this->start_];
         return 0;
     }
 
@@ -213,14 +292,25 @@ public:
      * @param[in] n     Maximum Number of elements to take from @p src.
      * @returns         Number of added elements.
      */
-    auto add(ValueType src[], SizeType n) -> SizeType
+    auto add(ValueType const src[], SizeType n) -> SizeType
     {
         SizeType free = this->getFree();
         if (n > free) {
+            this->onReject(n - free);
             n = free;
         }
-        for (SizeType i = 0; i < n; ++i) {
-            this->putOne(src[i]);
+        // Copy in up to two contiguous chunks: Up to the end of mem_, then from its start.
+        SizeType tail = wrap_(this->start_ + this->avail_);
+        SizeType first = (n < Size - tail) ? n : Size - tail;
+        for (SizeType i = 0; i < first; ++i) {
+            this->mem_[tail + i] = src[i];
+        }
+        for (SizeType i = first; i < n; ++i) {
+            this->mem_[i - first] = src[i];
+        }
+        this->avail_ += n;
+        if (n > 0) {
+            this->onPut(n, this->avail_);
         }
         return n;
     }
@@ -233,13 +323,10 @@ public:
      */
     auto get(ValueType dst[], SizeType n) -> SizeType
     {
-        SizeType avail = Size - this->getFree();
-        if (n > avail) {
-            n = avail;
-        }
-        for (SizeType i = 0; i < n; ++i) {
-            this->getHead_(dst[i]);
-        }
+        n = this->peek(dst, n);
+        this->start_ = wrap_(this->start_ + n);
+        this->avail_ -= n;
+        this->onGet(n);
         return n;
     }
 
@@ -252,18 +339,17 @@ public:
      */
     auto peek(ValueType dst[], SizeType n) const -> SizeType
     {
-        // Save ringbuffer state
-        ringbuffer_t rbufOld = this->rbuf_;
-        // Perform peek-operation
-        SizeType avail = Size - this->getFree();
-        if (n > avail) {
-            n = avail;
+        if (n > this->avail_) {
+            n = this->avail_;
         }
-        for (SizeType i = 0; i < n; ++i) {
-            this->getHead_(dst[i]);
+        // Copy in up to two contiguous chunks: Up to the end of mem_, then from its start.
+        SizeType first = (n < Size - this->start_) ? n : Size - this->start_;
+        for (SizeType i = 0; i < first; ++i) {
+            dst[i] = this->mem_[this->start_ + i];
+        }
+        for (SizeType i = first; i < n; ++i) {
+            dst[i] = this->mem_[i - first];
         }
-        // Restore ringbuffer state
-        this->rbuf_ = rbufOld;
         return n;
     }
 
@@ -273,7 +359,7 @@ public:
      */
     auto getFree() const -> SizeType
     {
-        return ringbuffer_get_free(&(this->rbuf_)) / sizeof(ValueType);
+        return Size - this->avail_;
     }
 
     /**
@@ -283,7 +369,7 @@ public:
      */
     auto empty() const -> int
     {
-        return ringbuffer_empty(&(this->rbuf_));
+        return this->avail_ == 0;
     }
 
     /**
@@ -293,7 +379,7 @@ public:
      */
     auto full() const -> int
     {
-        return ringbuffer_full(&(this->rbuf_));
+        return this->avail_ == Size;
     }
 
     /**
@@ -303,34 +389,159 @@ public:
      */
     auto remove(SizeType const n) -> SizeType
     {
-        SizeType actualSize = n * sizeof(ValueType);
-        SizeType ret = ringbuffer_remove(&(this->rbuf_), actualSize);
-        if (ret == actualSize) {
-            return n;
+        SizeType removed = (n < this->avail_) ? n : this->avail_;
+        this->start_ = wrap_(this->start_ + removed);
+        this->avail_ -= removed;
+        this->onGet(removed);
+        return removed;
+    }
+
+    /**
+     * @brief Write up to @p len bytes to a byte Ringbuffer.
+     * @note Does not override existing bytes. Copies with at most two memcpy calls.
+     * @param[in] src   Bytes to write.
+     * @param[in] len   Number of bytes in @p src.
+     * @returns         Number of written bytes.
+     */
+    auto write(void const * src, SizeType len) -> SizeType
+    {
+        static_assert(keepout::RingbufferIsByte<ValueType>::value,
+                      "write() requires a Ringbuffer of uint8_t, int8_t or char.");
+        SizeType free = this->getFree();
+        if (len > free) {
+            this->onReject(len - free);
+            len = free;
         }
-        return (ret / sizeof(ValueType));
+        SizeType tail = wrap_(this->start_ + this->avail_);
+        SizeType first = (len < Size - tail) ? len : Size - tail;
+        memcpy(this->mem_ + tail, src, first);
+        memcpy(this->mem_, static_cast<uint8_t const *>(src) + first, len - first);
+        this->avail_ += len;
+        if (len > 0) {
+            this->onPut(len, this->avail_);
+        }
+        return len;
+    }
+
+    /**
+     * @brief Read up to @p len bytes from a byte Ringbuffer.
+     * @note Copies with at most two memcpy calls.
+     * @param[out] dst   Buffer to store read bytes.
+     * @param[in] len    Size of @p dst.
+     * @returns          Number of read bytes.
+     */
+    auto read(void * dst, SizeType len) -> SizeType
+    {
+        static_assert(keepout::RingbufferIsByte<ValueType>::value,
+                      "read() requires a Ringbuffer of uint8_t, int8_t or char.");
+        if (len > this->avail_) {
+            len = this->avail_;
+        }
+        SizeType first = (len < Size - this->start_) ? len : Size - this->start_;
+        memcpy(dst, this->mem_ + this->start_, first);
+        memcpy(static_cast<uint8_t *>(dst) + first, this->mem_, len - first);
+        this->start_ = wrap_(this->start_ + len);
+        this->avail_ -= len;
+        this->onGet(len);
+        return len;
+    }
+
+    /**
+     * @brief Read bytes up to and including the first @p delimiter from a
+     *        byte Ringbuffer. Nothing is read if no delimiter is found.
+     * @param[out] dst         Buffer to store read bytes.
+     * @param[in] len          Size of @p dst.
+     * @param[in] delimiter    Byte terminating the read sequence.
+     * @returns                Number of read bytes including @p delimiter.
+     *                         -EAGAIN if the stored bytes contain no @p delimiter.
+     *                         -ENOBUFS if no @p delimiter is within the first
+     *                         @p len bytes.
+     */
+    auto readUntil(void * dst, SizeType const len, ValueType const delimiter) -> int
+    {
+        static_assert(keepout::RingbufferIsByte<ValueType>::value,
+                      "readUntil() requires a Ringbuffer of uint8_t, int8_t or char.");
+        SizeType pos = this->find_(delimiter);
+        if (pos == this->avail_) {
+            return (this->avail_ < len) ? -EAGAIN : -ENOBUFS;
+        }
+        if (pos >= len) {
+            return -ENOBUFS;
+        }
+        return this->read(dst, pos + 1);
+    }
+
+    /**
+     * @brief Discard up to @p len bytes from a byte Ringbuffer.
+     * @param[in] len   Number of bytes to discard.
+     * @returns         Number of discarded bytes.
+     */
+    auto skip(SizeType const len) -> SizeType
+    {
+        static_assert(keepout::RingbufferIsByte<ValueType>::value,
+                      "skip() requires a Ringbuffer of uint8_t, int8_t or char.");
+        return this->remove(len);
+    }
+
+    /**
+     * @brief Access recorded statistics.
+     * @returns   Reference to statistics policy object.
+     */
+    auto stats() const -> StatsType const &
+    {
+        return *this;
+    }
+
+    /**
+     * @brief Reset recorded statistics.
+     */
+    auto resetStats() -> void
+    {
+        Stats::reset();
     }
 
 private:
+    /**
+     * @brief Map a position in [0, 2 * Size) to an index into mem_.
+     * @param[in] pos   Position to map.
+     * @returns         Index into mem_.
+     */
+    static auto wrap_(SizeType const pos) -> SizeType
+    {
+        return (pos >= Size) ? pos - Size : pos;
+    }
+
+    /**
+     * @brief Position of the first @p value relative to the oldest element.
+     * @note Searches with at most two memchr calls.
+     * @param[in] value   Byte to search for.
+     * @returns           Position of @p value. avail_ if not found.
+     */
+    auto find_(ValueType const value) const -> SizeType
+    {
+        SizeType first = (this->avail_ < Size - this->start_) ? this->avail_ : Size - this->start_;
+        void const * p = memchr(this->mem_ + this->start_, value, first);
+        if (p != nullptr) {
+            return static_cast<ValueType const *>(p) - (this->mem_ + this->start_);
+        }
+        p = memchr(this->mem_, value, this->avail_ - first);
+        if (p != nullptr) {
+            return first + (static_cast<ValueType const *>(p) - this->mem_);
+        }
+        return this->avail_;
+    }
+
     /**
      * @brief Get oldest element from the ringbuffer.
      * @note Internal function, performs no boundry checks.
-     * @note constness added to ensure consitent API (peek() implementation)
      * @pre ValueType must be copy-assignable.
      * @param[out] dst   Reference to assign oldest element in ringbuffer to.
      */
-    auto getHead_(Reference dst) const -> void
+    auto getHead_(Reference dst) -> void
     {
-        // Assign Object directly from current read position.
-        // Hacky but avoids problems that come with memcpy.
-        ConstPointer p = reinterpret_cast<ConstPointer>(this->rbuf_.buf +
-                                                        this->rbuf_.start);
-        dst = *p;
-
-        // Read sizeof(ValueType) bytes from ringbuffer -> Removes Object.
-        for (SizeType i = 0; i < sizeof(ValueType); ++i) {
-            ringbuffer_get_one(&(this->rbuf_));
-        }
+        dst = this->mem_[this->start_];
+        this->start_ = wrap_(this->start_ + 1);
+        this->avail_ -= 1;
     }
 
     /**
@@ -341,22 +552,14 @@ private:
      */
     auto addTail_(ConstReference src) -> void
     {
-        // Calculate pointer to position to assign src to.
-        SizeType offset = rbuf_.start + rbuf_.avail;
-        if (offset >= rbuf_.size) {
-            offset -= rbuf_.size;
-        }
-        Pointer p = reinterpret_cast<Pointer>(this->rbuf_.buf + offset);
-        // Clear memory in Ringbuffer. Function updates Ringbuffer.
-        for (SizeType i = 0; i < sizeof(ValueType); ++i) {
-            ringbuffer_add_one(&(this->rbuf_), 0);
-        }
-        // Assign Object to pre-calculated position in Ringbuffer.
-        *p = src;
+        this->mem_[wrap_(this->start_ + this->avail_)] = src;
+        this->avail_ += 1;
+        this->onPut(1, this->avail_);
     }
 
-    ValueType mem_[Size];       /**< Memory used for the ringbuffer */
-    mutable ringbuffer_t rbuf_; /**< Wrapped ringbuffer struct */
+    ValueType mem_[Size]; /**< Memory used for the ringbuffer */
+    IndexType start_;     /**< Index of the oldest element */
+    IndexType avail_;     /**< Number of stored elements */
 };
 
 /**
@@ -364,10 +567,10 @@ private:
  * @param[in,out] lhs   ringbuffer (left hand side).
  * @param[in,out] rhs   ringbuffer (right hand side).
  */
-template <typename T, std::size_t Size>
-auto swap(Ringbuffer<T, Size> & lhs, Ringbuffer<T, Size> & rhs) -> void
+template <typename T, std::size_t Size, typename Stats>
+auto swap(Ringbuffer<T, Size, Stats> & lhs, Ringbuffer<T, Size, Stats> & rhs) -> void
 {
-    Ringbuffer<T, Size> tmp(rhs);
+    Ringbuffer<T, Size, Stats> tmp(rhs);
     rhs = lhs;
     lhs = tmp;
 }
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Statistics policies for Ringbuffer.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef RINGBUFFERSTATS_IMPL_HPP
+#define RINGBUFFERSTATS_IMPL_HPP
+
+#include <cstdint>
+
+namespace riot
+{
+
+/**
+ * @brief Ringbuffer statistics policy: No statistics are recorded.
+ * @note Empty class with empty inline hooks. Adds neither memory nor
+ *       instructions to a Ringbuffer.
+ */
+class RingbufferNoStats
+{
+public:
+    auto onPut(std::size_t const, std::size_t const) -> void
+    {
+    }
+
+    auto onGet(std::size_t const) -> void
+    {
+    }
+
+    auto onReject(std::size_t const) -> void
+    {
+    }
+
+    auto onOverwrite() -> void
+    {
+    }
+
+    auto reset() -> void
+    {
+    }
+};
+
+/**
+ * @brief Ringbuffer statistics policy: Records fill level and element counters.
+ */
+class RingbufferStats
+{
+public:
+    /**
+     * @brief Default Constructor. All counters are zero.
+     */
+    RingbufferStats()
+    {
+        this->reset();
+    }
+
+    /**
+     * @brief Hook: Elements were stored.
+     * @param[in] n      Number of stored elements.
+     * @param[in] fill   Number of stored elements afterwards.
+     */
+    auto onPut(std::size_t const n, std::size_t const fill) -> void
+    {
+        this->puts_ += n;
+        if (fill > this->highWater_) {
+            this->highWater_ = fill;
+        }
+    }
+
+    /**
+     * @brief Hook: Elements were taken.
+     * @param[in] n   Number of taken elements.
+     */
+    auto onGet(std::size_t const n) -> void
+    {
+        this->gets_ += n;
+    }
+
+    /**
+     * @brief Hook: Elements were not stored, because the ringbuffer was full.
+     * @param[in] n   Number of rejected elements.
+     */
+    auto onReject(std::size_t const n) -> void
+    {
+        this->rejected_ += n;
+    }
+
+    /**
+     * @brief Hook: The oldest element was overwritten.
+     */
+    auto onOverwrite() -> void
+    {
+        this->overwritten_ += 1;
+    }
+
+    /**
+     * @brief Reset all counters to zero.
+     */
+    auto reset() -> void
+    {
+        this->highWater_ = 0;
+        this->rejected_ = 0;
+        this->overwritten_ = 0;
+        this->puts_ = 0;
+        this->gets_ = 0;
+    }
+
+    /**
+     * @brief Maximum number of elements stored at the same time.
+     * @returns   High-water mark.
+     */
+    auto highWater() const -> uint32_t
+    {
+        return this->highWater_;
+    }
+
+    /**
+     * @brief Number of elements rejected by putOne() and add() (-ENOMEM).
+     * @returns   Rejected elements.
+     */
+    auto rejected() const -> uint32_t
+    {
+        return this->rejected_;
+    }
+
+    /**
+     * @brief Number of elements overwritten by addOne() on a full ringbuffer.
+     * @returns   Overwritten elements.
+     */
+    auto overwritten() const -> uint32_t
+    {
+        return this->overwritten_;
+    }
+
+    /**
+     * @brief Number of stored elements.
+     * @returns   Total puts.
+     */
+    auto puts() const -> uint32_t
+    {
+        return this->puts_;
+    }
+
+    /**
+     * @brief Number of elements taken by getOne() and get() or discarded
+     *        by remove() and skip().
+     * @returns   Total gets.
+     */
+    auto gets() const -> uint32_t
+    {
+        return this->gets_;
+    }
+
+private:
+    uint32_t highWater_;
+    uint32_t rejected_;
+    uint32_t overwritten_;
+    uint32_t puts_;
+    uint32_t gets_;
+};
+
+} // namespace riot
+#endif // RINGBUFFERSTATS_IMPL_HPP
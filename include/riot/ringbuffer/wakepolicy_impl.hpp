@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Reader wake-up policies for BlockingRingbuffer.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef WAKEPOLICY_IMPL_HPP
+#define WAKEPOLICY_IMPL_HPP
+
+#include <cstdint>
+#include "xtimer.h"
+
+namespace riot
+{
+
+/**
+ * @brief Wake-up policy: Every added element is handed to the readers at once.
+ */
+class WakeEach
+{
+protected:
+    /**
+     * @brief Hook: An element was added.
+     * @returns   Number of elements to hand to the readers now.
+     */
+    auto wakeAdded(void (*)(void *), void *) -> std::size_t
+    {
+        return 1;
+    }
+
+    /**
+     * @brief Hook: Hand all withheld elements to the readers.
+     * @returns   Number of elements to hand to the readers now.
+     */
+    auto wakeFlush() -> std::size_t
+    {
+        return 0;
+    }
+
+    /**
+     * @brief Hook: The owner is destroyed.
+     */
+    auto wakeStop() -> void
+    {
+    }
+};
+
+/**
+ * @brief Wake-up policy: Added elements are withheld from the readers until
+ *        @p Threshold elements are withheld or the first withheld element
+ *        waited @p Delay microseconds. Requires 'xtimer' Module.
+ * @note Readers blocked in get operations wake once per batch instead of
+ *       once per element. tryGet() does not see withheld elements.
+ * @note The delay is armed by the first withheld element. Elements may be
+ *       handed over earlier, never later than @p Delay plus timer latency.
+ */
+template <std::size_t Threshold, uint32_t Delay>
+class WakeCoalesced
+{
+    static_assert(Threshold > 0, "WakeCoalesced Threshold must not be zero.");
+
+protected:
+    WakeCoalesced()
+        : withheld_(0)
+        , timer_()
+    {
+        this->timer_.callback = nullptr;
+        this->timer_.arg = nullptr;
+    }
+
+    ~WakeCoalesced()
+    {
+        this->wakeStop();
+    }
+
+    /**
+     * @brief Hook: An element was added.
+     * @param[in] flush   Callback handing the withheld elements over. Called
+     *                    from the timer interrupt after @p Delay.
+     * @param[in] arg     Argument of @p flush.
+     * @returns   Number of elements to hand to the readers now.
+     */
+    auto wakeAdded(void (*flush)(void *), void * arg) -> std::size_t
+    {
+        std::size_t withheld = __atomic_add_fetch(&this->withheld_, 1, __ATOMIC_ACQ_REL);
+        if (withheld >= Threshold) {
+            xtimer_remove(&this->timer_);
+            return this->wakeFlush();
+        }
+        if (withheld == 1) {
+            this->timer_.callback = flush;
+            this->timer_.arg = arg;
+            xtimer_set(&this->timer_, Delay);
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Hook: Hand all withheld elements to the readers.
+     * @note Safe to call from interrupt context.
+     * @returns   Number of elements to hand to the readers now.
+     */
+    auto wakeFlush() -> std::size_t
+    {
+        return __atomic_exchange_n(&this->withheld_, 0, __ATOMIC_ACQ_REL);
+    }
+
+    /**
+     * @brief Hook: The owner is destroyed. Removes the pending timer, the
+     *        owners flush callback must not run afterwards.
+     */
+    auto wakeStop() -> void
+    {
+        xtimer_remove(&this->timer_);
+    }
+
+private:
+    std::size_t withheld_; /**< Added elements not yet handed to the readers */
+    xtimer_t timer_;       /**< Fires @p Delay after the first withheld element */
+};
+
+} // namespace riot
+#endif // WAKEPOLICY_IMPL_HPP
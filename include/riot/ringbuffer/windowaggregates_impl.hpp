@@ -0,0 +1,367 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Incremental aggregates for WindowedRingbuffer.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef WINDOWAGGREGATES_IMPL_HPP
+#define WINDOWAGGREGATES_IMPL_HPP
+
+#include <cstdint>
+#include "ringbuffer_impl.hpp"
+
+namespace riot
+{
+
+namespace keepout
+{
+
+/**
+ * @brief Selects the type running sums over values of type @p T are kept in.
+ *        Integers are summed in 64 bit, float in double. Other types in T.
+ */
+template <typename T>
+class WindowAccumulator
+{
+public:
+    typedef T Type;
+};
+
+template <>
+class WindowAccumulator<int8_t>
+{
+public:
+    typedef int64_t Type;
+};
+
+template <>
+class WindowAccumulator<int16_t>
+{
+public:
+    typedef int64_t Type;
+};
+
+template <>
+class WindowAccumulator<int32_t>
+{
+public:
+    typedef int64_t Type;
+};
+
+template <>
+class WindowAccumulator<uint8_t>
+{
+public:
+    typedef uint64_t Type;
+};
+
+template <>
+class WindowAccumulator<uint16_t>
+{
+public:
+    typedef uint64_t Type;
+};
+
+template <>
+class WindowAccumulator<uint32_t>
+{
+public:
+    typedef uint64_t Type;
+};
+
+template <>
+class WindowAccumulator<float>
+{
+public:
+    typedef double Type;
+};
+
+/**
+ * @brief Monotonic deque of up to @p N values of type @p T with their
+ *        sequence numbers. The front holds the value preferred by @p Less
+ *        among all values pushed since. Push and pop are amortized O(1).
+ * @note @p Less(a, b) is true if a is preferred over b.
+ */
+template <typename T, std::size_t N, bool (*Less)(T const &, T const &)>
+class WindowDeque
+{
+public:
+    WindowDeque()
+        : head_(0)
+        , size_(0)
+    {
+    }
+
+    // Append @p v. Drops all values @p v is preferred over or equal to.
+    auto push(T const & v, uint32_t const seq) -> void
+    {
+        while (this->size_ > 0 && !Less(this->values_[this->back_()], v)) {
+            this->size_ -= 1;
+        }
+        std::size_t pos = this->head_ + this->size_;
+        pos = (pos >= N) ? pos - N : pos;
+        this->values_[pos] = v;
+        this->seqs_[pos] = seq;
+        this->size_ += 1;
+    }
+
+    // Value with sequence number @p seq left the window.
+    auto pop(uint32_t const seq) -> void
+    {
+        if (this->size_ > 0 && this->seqs_[this->head_] == seq) {
+            this->head_ = (this->head_ + 1 == N) ? 0 : this->head_ + 1;
+            this->size_ -= 1;
+        }
+    }
+
+    auto clear() -> void
+    {
+        this->head_ = 0;
+        this->size_ = 0;
+    }
+
+    // Preferred value. T() if empty.
+    auto front() const -> T
+    {
+        return (this->size_ > 0) ? this->values_[this->head_] : T();
+    }
+
+private:
+    typedef typename RingbufferIndex<N>::Type SizeType;
+
+    auto back_() const -> std::size_t
+    {
+        std::size_t pos = this->head_ + this->size_ - 1;
+        return (pos >= N) ? pos - N : pos;
+    }
+
+    T values_[N];
+    uint32_t seqs_[N];
+    SizeType head_;
+    SizeType size_;
+};
+
+template <typename T>
+auto windowLess(T const & a, T const & b) -> bool
+{
+    return a < b;
+}
+
+template <typename T>
+auto windowGreater(T const & a, T const & b) -> bool
+{
+    return b < a;
+}
+
+} // namespace keepout
+
+/**
+ * @brief Window aggregate: Sum and mean of the values in the window.
+ * @note O(1) per value. Integer means are truncated.
+ */
+template <typename T, std::size_t N>
+class WindowSum
+{
+public:
+    typedef typename keepout::WindowAccumulator<T>::Type AccumulatorType;
+
+    WindowSum()
+        : sum_()
+        , count_(0)
+    {
+    }
+
+    /**
+     * @brief Sum of the values in the window.
+     * @returns   Sum. Zero if the window is empty.
+     */
+    auto sum() const -> AccumulatorType
+    {
+        return this->sum_;
+    }
+
+    /**
+     * @brief Arithmetic mean of the values in the window.
+     * @returns   Mean. Zero if the window is empty.
+     */
+    auto mean() const -> AccumulatorType
+    {
+        return (this->count_ > 0) ? this->sum_ / static_cast<AccumulatorType>(this->count_)
+                                  : AccumulatorType();
+    }
+
+    // Hooks called by WindowedRingbuffer.
+    auto onPush(T const & v, uint32_t const) -> void
+    {
+        this->sum_ += v;
+        this->count_ += 1;
+    }
+
+    auto onPop(T const & v, uint32_t const) -> void
+    {
+        this->sum_ -= v;
+        this->count_ -= 1;
+    }
+
+    auto onClear() -> void
+    {
+        this->sum_ = AccumulatorType();
+        this->count_ = 0;
+    }
+
+private:
+    AccumulatorType sum_;
+    std::size_t count_;
+};
+
+/**
+ * @brief Window aggregate: Population variance of the values in the window.
+ * @note O(1) per value. Keeps the sum and the sum of squares, which must
+ *       fit into AccumulatorType.
+ */
+template <typename T, std::size_t N>
+class WindowVariance
+{
+public:
+    typedef typename keepout::WindowAccumulator<T>::Type AccumulatorType;
+
+    WindowVariance()
+        : sum_()
+        , sumSq_()
+        , count_(0)
+    {
+    }
+
+    /**
+     * @brief Population variance of the values in the window.
+     * @returns   Variance. Zero if the window is empty.
+     */
+    auto variance() const -> AccumulatorType
+    {
+        if (this->count_ == 0) {
+            return AccumulatorType();
+        }
+        AccumulatorType n = static_cast<AccumulatorType>(this->count_);
+        return (n * this->sumSq_ - this->sum_ * this->sum_) / (n * n);
+    }
+
+    // Hooks called by WindowedRingbuffer.
+    auto onPush(T const & v, uint32_t const) -> void
+    {
+        AccumulatorType a = v;
+        this->sum_ += a;
+        this->sumSq_ += a * a;
+        this->count_ += 1;
+    }
+
+    auto onPop(T const & v, uint32_t const) -> void
+    {
+        AccumulatorType a = v;
+        this->sum_ -= a;
+        this->sumSq_ -= a * a;
+        this->count_ -= 1;
+    }
+
+    auto onClear() -> void
+    {
+        this->sum_ = AccumulatorType();
+        this->sumSq_ = AccumulatorType();
+        this->count_ = 0;
+    }
+
+private:
+    AccumulatorType sum_;
+    AccumulatorType sumSq_;
+    std::size_t count_;
+};
+
+/**
+ * @brief Window aggregate: Minimum of the values in the window.
+ * @note Monotonic deque: Amortized O(1) per value, N values extra memory.
+ */
+template <typename T, std::size_t N>
+class WindowMin
+{
+public:
+    /**
+     * @brief Minimum of the values in the window.
+     * @returns   Minimum. T() if the window is empty.
+     */
+    auto min() const -> T
+    {
+        return this->deque_.front();
+    }
+
+    // Hooks called by WindowedRingbuffer.
+    auto onPush(T const & v, uint32_t const seq) -> void
+    {
+        this->deque_.push(v, seq);
+    }
+
+    auto onPop(T const &, uint32_t const seq) -> void
+    {
+        this->deque_.pop(seq);
+    }
+
+    auto onClear() -> void
+    {
+        this->deque_.clear();
+    }
+
+private:
+    keepout::WindowDeque<T, N, keepout::windowLess<T>> deque_;
+};
+
+/**
+ * @brief Window aggregate: Maximum of the values in the window.
+ * @note Monotonic deque: Amortized O(1) per value, N values extra memory.
+ */
+template <typename T, std::size_t N>
+class WindowMax
+{
+public:
+    /**
+     * @brief Maximum of the values in the window.
+     * @returns   Maximum. T() if the window is empty.
+     */
+    auto max() const -> T
+    {
+        return this->deque_.front();
+    }
+
+    // Hooks called by WindowedRingbuffer.
+    auto onPush(T const & v, uint32_t const seq) -> void
+    {
+        this->deque_.push(v, seq);
+    }
+
+    auto onPop(T const &, uint32_t const seq) -> void
+    {
+        this->deque_.pop(seq);
+    }
+
+    auto onClear() -> void
+    {
+        this->deque_.clear();
+    }
+
+private:
+    keepout::WindowDeque<T, N, keepout::windowGreater<T>> deque_;
+};
+
+} // namespace riot
+#endif // WINDOWAGGREGATES_IMPL_HPP
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Ringbuffer keeping sliding-window aggregates up to date.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef WINDOWEDRINGBUFFER_IMPL_HPP
+#define WINDOWEDRINGBUFFER_IMPL_HPP
+
+#include <cstdint>
+#include "ringbuffer_impl.hpp"
+#include "windowaggregates_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Sliding window over the last @p N values of type @p T. Each of the
+ *        @p Aggregates is updated incrementally on every add, so querying
+ *        an aggregate never iterates over the window.
+ * @note Available aggregates: WindowSum (sum(), mean()),
+ *       WindowVariance (variance()), WindowMin (min()), WindowMax (max()).
+ *       Queries are called directly on the window:
+ *       WindowedRingbuffer<int16_t, 32, WindowSum, WindowMax> w; w.max();
+ * @note A custom aggregate is a class template over <T, N> providing
+ *       onPush(value, seq), onPop(value, seq) and onClear(). Every value is
+ *       pushed with an increasing sequence number and popped with the same
+ *       number once it leaves the window.
+ * @note Not threadsafe.
+ */
+template <typename T, std::size_t N, template <typename, std::size_t> class... Aggregates>
+class WindowedRingbuffer : public Aggregates<T, N>...
+{
+public:
+    // Define Member types
+    typedef T ValueType;
+    typedef T & Reference;
+    typedef T const & ConstReference;
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Default Constructor. Create empty window.
+     */
+    WindowedRingbuffer()
+        : seq_(0)
+    {
+    }
+
+    /**
+     * @brief Add a value to the window. If the window is full, the oldest
+     *        value leaves the window.
+     * @param[in] src   Value to add.
+     */
+    auto add(ConstReference src) -> void
+    {
+        ValueType removed;
+        if (this->buffer_.addOne(src, removed) == 0) {
+            this->pop_(removed, this->seq_ - N);
+        }
+        this->push_(src, this->seq_);
+        this->seq_ += 1;
+    }
+
+    /**
+     * @brief Add values to the window. If the window is full, the oldest
+     *        values leave the window.
+     * @param[in] src   Array of values to add.
+     * @param[in] n     Number of values in @p src.
+     */
+    auto add(ValueType const src[], SizeType const n) -> void
+    {
+        for (SizeType i = 0; i < n; ++i) {
+            this->add(src[i]);
+        }
+    }
+
+    /**
+     * @brief Copy the values in the window, oldest first.
+     * @param[out] dst   Array to store the values in.
+     * @param[in] n      Maximum number of values to store in @p dst.
+     * @returns          Number of copied values.
+     */
+    auto peek(ValueType dst[], SizeType const n) const -> SizeType
+    {
+        return this->buffer_.peek(dst, n);
+    }
+
+    /**
+     * @brief Remove all values from the window and reset the aggregates.
+     */
+    auto clear() -> void
+    {
+        this->buffer_.remove(N);
+        int expand[] = {0, (Aggregates<T, N>::onClear(), 0)...};
+        (void) expand;
+    }
+
+    /**
+     * @brief Number of values in the window.
+     * @returns   Values in the window. At most @p N.
+     */
+    auto size() const -> SizeType
+    {
+        return N - this->buffer_.getFree();
+    }
+
+    /**
+     * @brief Check if the window is empty.
+     * @returns   non-zero if the window is empty.
+     *            zero if the window contains values.
+     */
+    auto empty() const -> int
+    {
+        return this->buffer_.empty();
+    }
+
+    /**
+     * @brief Check if the window is full. Further adds evict the oldest value.
+     * @returns   non-zero if the window is full.
+     *            zero if the window is not full.
+     */
+    auto full() const -> int
+    {
+        return this->buffer_.full();
+    }
+
+private:
+    auto push_(ConstReference v, uint32_t const seq) -> void
+    {
+        int expand[] = {0, (Aggregates<T, N>::onPush(v, seq), 0)...};
+        (void) expand;
+    }
+
+    auto pop_(ConstReference v, uint32_t const seq) -> void
+    {
+        int expand[] = {0, (Aggregates<T, N>::onPop(v, seq), 0)...};
+        (void) expand;
+    }
+
+    Ringbuffer<T, N> buffer_; /**< Values in the window */
+    uint32_t seq_;            /**< Sequence number of the next value */
+};
+
+} // namespace riot
+#endif // WINDOWEDRINGBUFFER_IMPL_HPP
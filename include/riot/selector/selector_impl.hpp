@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Wait on several blocking ringbuffers and semaphores at once.
+  *              Requires 'sema', 'core_thread_flags' and 'xtimer' Module.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef SELECTOR_IMPL_HPP
+#define SELECTOR_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "thread.h"
+#include "thread_flags.h"
+#include "xtimer.h"
+#include "../semaphore/watchablesemaphore_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Blocks the owning thread until one of up to @p Sources registered
+ *        sources becomes ready and completes the operation on it.
+ * @note A ringbuffer source is ready if it holds an element. Selecting it
+ *       gets the oldest element into the destination given on add(). A
+ *       semaphore source is ready if it is posted. Selecting it decrements
+ *       the semaphore. Sources are tried round-robin, so a busy source does
+ *       not starve the others.
+ * @note Sources must use WatchableSemaphore. The selector replaces their
+ *       watch with one setting @p Flag on the owning thread, so each post
+ *       wakes the owner with a single thread_flags_set(). A source can be
+ *       watched by one Selector or Executor at a time.
+ * @note The owning thread is the thread constructing the Selector. Only it
+ *       may call the wait operations.
+ */
+template <std::size_t Sources, thread_flags_t Flag = 0x0001>
+class Selector
+{
+    static_assert(Sources > 0, "Selector Sources must not be zero.");
+    static_assert(Flag != 0 && (Flag & THREAD_FLAG_TIMEOUT) == 0,
+                  "Selector Flag must be non-zero and must not contain THREAD_FLAG_TIMEOUT.");
+
+public:
+    // Define Member types
+    typedef std::size_t SizeType;
+
+    /**
+     * @brief Default Constructor. Create Selector without sources, owned by
+     *        the calling thread.
+     */
+    Selector()
+        : thread_(thread_get(thread_getpid()))
+        , size_(0)
+        , next_(0)
+    {
+        this->watch_.notify = &Selector::notify_;
+        this->watch_.arg = this;
+    }
+
+    /**
+     * @brief Destructor. Removes the watch from all sources.
+     */
+    ~Selector()
+    {
+        for (SizeType i = 0; i < this->size_; ++i) {
+            this->sources_[i].watch(this->sources_[i].source, nullptr);
+        }
+    }
+
+    /**
+     * @brief Register a blocking ringbuffer.
+     * @note Requires Sema = WatchableSemaphore.
+     * @param[in]  queue   Blocking ringbuffer to get elements from.
+     * @param[out] dst     Destination of the element got on selection.
+     *                     Must stay valid while the Selector exists.
+     * @returns   Id of the source, returned by the wait operations.
+     *            -ENOMEM if @p Sources sources are registered.
+     */
+    template <typename Queue>
+    auto add(Queue & queue, typename Queue::Reference dst) -> int
+    {
+        return this->add_(&queue, &dst, &Selector::tryGet_<Queue>, &Selector::watchSource_<Queue>);
+    }
+
+    /**
+     * @brief Register a semaphore.
+     * @param[in] sema   Semaphore to decrement on selection.
+     * @returns   Id of the source, returned by the wait operations.
+     *            -ENOMEM if @p Sources sources are registered.
+     */
+    auto add(WatchableSemaphore & sema) -> int
+    {
+        return this->add_(&sema, nullptr, &Selector::tryWait_,
+                          &Selector::watchSource_<WatchableSemaphore>);
+    }
+
+    /**
+     * @brief Wait until a source is ready and complete its operation.
+     * @note Blocks until a source is ready.
+     * @returns   Id of the selected source.
+     *            -EINVAL if no source is registered.
+     */
+    auto wait() -> int
+    {
+        if (this->size_ == 0) {
+            return -EINVAL;
+        }
+        for (;;) {
+            int id = this->poll_();
+            if (id >= 0) {
+                return id;
+            }
+            thread_flags_wait_any(Flag);
+        }
+    }
+
+    /**
+     * @brief Complete the operation of a ready source (non-blocking).
+     * @returns   Id of the selected source.
+     *            -EAGAIN if no source is ready.
+     *            -EINVAL if no source is registered.
+     */
+    auto tryWait() -> int
+    {
+        if (this->size_ == 0) {
+            return -EINVAL;
+        }
+        return this->poll_();
+    }
+
+    /**
+     * @brief Wait until a source is ready and complete its operation. Blocks
+     *        until a source is ready or a timeout expired.
+     * @param[in] timeout   Timeout duration in microseconds.
+     * @returns   Id of the selected source.
+     *            -ETIMEDOUT if timeout expired after @p timeout.
+     *            -EINVAL if no source is registered.
+     */
+    auto waitTimed(uint64_t const timeout) -> int
+    {
+        if (this->size_ == 0) {
+            return -EINVAL;
+        }
+        uint64_t const deadline = xtimer_now_usec64() + timeout;
+        for (;;) {
+            int id = this->poll_();
+            if (id >= 0) {
+                return id;
+            }
+            uint64_t const now = xtimer_now_usec64();
+            if (now >= deadline) {
+                return -ETIMEDOUT;
+            }
+            uint64_t const remaining = deadline - now;
+            xtimer_t timer;
+            xtimer_set_timeout_flag(&timer, (remaining < UINT32_MAX) ? remaining : UINT32_MAX);
+            thread_flags_wait_any(Flag | THREAD_FLAG_TIMEOUT);
+            xtimer_remove(&timer);
+            thread_flags_clear(THREAD_FLAG_TIMEOUT);
+        }
+    }
+
+    /**
+     * @brief Number of registered sources.
+     * @returns   Registered sources.
+     */
+    auto size() const -> SizeType
+    {
+        return this->size_;
+    }
+
+    // Deleted with purpose
+    Selector(Selector const &) = delete;
+    Selector(Selector const &&) = delete;
+    auto operator = (Selector const &) -> Selector & = delete;
+    auto operator = (Selector const &&) -> Selector & = delete;
+
+private:
+    /**
+     * @brief Type erased source.
+     */
+    class Source
+    {
+    public:
+        void * source;                                    /**< Ringbuffer or semaphore */
+        void * dst;                                       /**< Destination of got elements */
+        auto (*attempt)(void *, void *) -> int;           /**< Non-blocking operation */
+        auto (*watch)(void *, SemaphoreWatch *) -> void;  /**< Set watch of source */
+    };
+
+    auto add_(void * source, void * dst, auto (*attempt)(void *, void *) -> int,
+              auto (*watch)(void *, SemaphoreWatch *) -> void) -> int
+    {
+        if (this->size_ >= Sources) {
+            return -ENOMEM;
+        }
+        Source & s = this->sources_[this->size_];
+        s.source = source;
+        s.dst = dst;
+        s.attempt = attempt;
+        s.watch = watch;
+        s.watch(source, &this->watch_);
+        this->size_ += 1;
+        return this->size_ - 1;
+    }
+
+    /**
+     * @brief Try all sources once, starting after the last selected one.
+     * @returns   Id of the selected source. -EAGAIN if no source is ready.
+     */
+    auto poll_() -> int
+    {
+        for (SizeType i = 0; i < this->size_; ++i) {
+            SizeType id = this->next_ + i;
+            id = (id >= this->size_) ? id - this->size_ : id;
+            Source & s = this->sources_[id];
+            int err = s.attempt(s.source, s.dst);
+            // -EOVERFLOW: Operation completed, but the post afterwards failed.
+            if (err == 0 || err == -EOVERFLOW) {
+                this->next_ = (id + 1 == this->size_) ? 0 : id + 1;
+                return id;
+            }
+        }
+        return -EAGAIN;
+    }
+
+    template <typename Queue>
+    static auto tryGet_(void * queue, void * dst) -> int
+    {
+        return static_cast<Queue *>(queue)->tryGet(*static_cast<typename Queue::ValueType *>(dst));
+    }
+
+    static auto tryWait_(void * sema, void *) -> int
+    {
+        return static_cast<WatchableSemaphore *>(sema)->tryWait();
+    }
+
+    template <typename Watched>
+    static auto watchSource_(void * source, SemaphoreWatch * w) -> void
+    {
+        static_cast<Watched *>(source)->watch(w);
+    }
+
+    static auto notify_(void * arg) -> void
+    {
+        thread_flags_set(static_cast<Selector *>(arg)->thread_, Flag);
+    }
+
+    Source sources_[Sources]; /**< Registered sources */
+    thread_t * thread_;       /**< Owning thread */
+    SizeType size_;           /**< Number of registered sources */
+    SizeType next_;           /**< Source to try first */
+    SemaphoreWatch watch_;    /**< Watch registered on all sources */
+};
+
+} // namespace riot
+#endif // SELECTOR_IMPL_HPP
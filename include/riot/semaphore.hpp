@@ -22,5 +22,6 @@
  */
 
 #include "semaphore/semaphore_impl.hpp"
+#include "semaphore/watchablesemaphore_impl.hpp"
 
 #endif // SEMAPHORE_HPP
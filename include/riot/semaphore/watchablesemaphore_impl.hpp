@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Semaphore notifying a watcher on every post.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef WATCHABLESEMAPHORE_IMPL_HPP
+#define WATCHABLESEMAPHORE_IMPL_HPP
+
+#include <cstdint>
+#include "semaphore_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Callback invoked after a watched semaphore was posted.
+ * @note Runs in the context of the posting thread or interrupt. Must not block.
+ */
+class SemaphoreWatch
+{
+public:
+    void (*notify)(void * arg); /**< Function to call on post */
+    void * arg;                 /**< Argument passed to notify */
+};
+
+/**
+ * @brief Semaphore calling a registered SemaphoreWatch after each successful
+ *        post. Lets a single thread wait for several semaphores, e.g. as
+ *        Sema parameter of BlockingRingbuffer.
+ * @note Supports one watch at a time. The watch must stay valid until it is
+ *       replaced or removed.
+ */
+class WatchableSemaphore
+{
+public:
+    /**
+     * @brief Constructor
+     * @param[in] value   The value the semaphore is initialized with.
+     */
+    WatchableSemaphore(std::size_t const value)
+        : sema_(value)
+        , watch_(nullptr)
+    {
+    }
+
+    /**
+     * @brief post operation on semaphore. Increases semaphore value and
+     *        notifies the watch.
+     * @returns   Zero on succees.
+     *            -EOVERFLOW, if semaphore value would overflow.
+     */
+    auto post() -> int
+    {
+        int err = this->sema_.post();
+        if (err) {
+            return err;
+        }
+        SemaphoreWatch * w = __atomic_load_n(&this->watch_, __ATOMIC_ACQUIRE);
+        if (w != nullptr) {
+            w->notify(w->arg);
+        }
+        return 0;
+    }
+
+    /**
+     * @brief wait operation on semaphore.
+     * @note Blocks if semaphore value is less or equal zero.
+     *       Until a post() call was performed.
+     * @returns   Zero on success.
+     *            -ECANCELED, if the semaphore was destroyed.
+     */
+    auto wait() -> int
+    {
+        return this->sema_.wait();
+    }
+
+    /**
+     * @brief Non-blocking wait() operation.
+     * @returns   Zero on success.
+     *            -EAGAIN, if the semaphore is not posted.
+     *            -ECANCELED, if the semaphore was destroyed.
+     */
+    auto tryWait() -> int
+    {
+        return this->sema_.tryWait();
+    }
+
+    /**
+     * @brief wait operation with timeout.
+     * @param[in] timeout   Timout duration in microseconds.
+     * @returns   Zero on success.
+     *            -ETIMEDOUT, if the semaphore times out.
+     *            -ECANCELED, if the semaphore was destroyed.
+     */
+    auto waitTimed(uint64_t const timeout) -> int
+    {
+        return this->sema_.waitTimed(timeout);
+    }
+
+    /**
+     * @brief Register @p w to be notified on every post. Replaces the
+     *        previous watch.
+     * @param[in] w   Watch to notify. nullptr removes the watch.
+     */
+    auto watch(SemaphoreWatch * w) -> void
+    {
+        __atomic_store_n(&this->watch_, w, __ATOMIC_RELEASE);
+    }
+
+private:
+    Semaphore sema_;         /**< Wrapped semaphore */
+    SemaphoreWatch * watch_; /**< Watch notified on post */
+
+    // Deleted with purpose
+    WatchableSemaphore(WatchableSemaphore const &) = delete;
+    WatchableSemaphore(WatchableSemaphore const &&) = delete;
+    auto operator = (WatchableSemaphore const &) -> WatchableSemaphore & = delete;
+    auto operator = (WatchableSemaphore const &&) -> WatchableSemaphore & = delete;
+};
+
+} // namespace riot
+#endif // WATCHABLESEMAPHORE_IMPL_HPP
@@ -0,0 +1,266 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Hierarchical timer wheel. Multiplexes any number of
+  *              timeouts onto a single periodic tick.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef TIMERWHEEL_IMPL_HPP
+#define TIMERWHEEL_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+#include "../array.hpp"
+#include "wheeltimer_impl.hpp"
+
+namespace riot
+{
+
+/**
+ * @brief Hierarchical timer wheel with @p Levels levels of 2^SlotBits
+ *        slots each. Schedule and cancel are O(1). Timers are stored as
+ *        intrusive lists in the slots, no memory is allocated.
+ * @note The TimerWheel has no notion of real time. Time advances only
+ *        by calls to tick(), advance() or advanceTo(). Drive these from a
+ *        single periodic timer or thread. This allows simulating time in
+ *        tests.
+ * @note The TimerWheel is not synchronized. All calls, including those
+ *        from expiry callbacks, must be made from the same context or be
+ *        protected by an external lock.
+ */
+template <std::size_t SlotBits = 6, std::size_t Levels = 4>
+class TimerWheel
+{
+    static_assert(SlotBits > 0, "TimerWheel SlotBits must not be zero.");
+    static_assert(Levels > 0, "TimerWheel Levels must not be zero.");
+    static_assert(SlotBits * Levels <= 32, "TimerWheel exceeds 32-Bit tick range.");
+
+public:
+    // Member Types
+    typedef std::size_t SizeType;
+    typedef uint32_t TickType;
+
+    /**
+     * @brief Default Constructor. Current tick is zero.
+     */
+    TimerWheel()
+        : slots_(nullptr)
+        , now_(0)
+    {
+    }
+
+    /**
+     * @brief Schedule @p timer to expire in @p delay ticks.
+     * @note An already scheduled timer is rescheduled.
+     * @param[in,out] timer   Timer to schedule.
+     * @param[in] delay       Number of ticks until expiry. Zero is
+     *                        treated as one (expiry on next tick).
+     * @returns               Zero on success.
+     *                        -EINVAL if @p delay exceeds maxDelay().
+     */
+    auto schedule(WheelTimer & timer, TickType delay) -> int
+    {
+        if (delay > maxDelay()) {
+            return -EINVAL;
+        }
+        if (delay == 0) {
+            delay = 1;
+        }
+        this->cancel(timer);
+        timer.expiry_ = this->now_ + delay;
+        this->place_(timer);
+        return 0;
+    }
+
+    /**
+     * @brief Cancel a scheduled timer.
+     * @param[in,out] timer   Timer to cancel.
+     * @returns               Zero if the timer was cancelled.
+     *                        -ENOENT if the timer was not scheduled.
+     */
+    auto cancel(WheelTimer & timer) -> int
+    {
+        if (!timer.scheduled()) {
+            return -ENOENT;
+        }
+        unlink_(timer);
+        return 0;
+    }
+
+    /**
+     * @brief Number of ticks until @p timer expires.
+     * @param[in] timer   Timer to query.
+     * @returns           Remaining ticks. Zero if not scheduled.
+     */
+    auto remaining(WheelTimer const & timer) const -> TickType
+    {
+        if (!timer.scheduled()) {
+            return 0;
+        }
+        return timer.expiry_ - this->now_;
+    }
+
+    /**
+     * @brief Advance time by one tick. Callbacks of all timers expiring
+     *        on this tick are called as one batch.
+     */
+    auto tick() -> void
+    {
+        this->now_ += 1;
+
+        // Move timers of due higher level slots to lower levels.
+        for (SizeType level = 1; level < Levels; ++level) {
+            if ((this->now_ & ((TickType(1) << (SlotBits * level)) - 1)) != 0) {
+                break;
+            }
+            this->cascade_(level);
+        }
+
+        // Detach level zero slot and call callbacks of all its timers.
+        WheelTimer *& slot = this->slot_(0, this->now_);
+        WheelTimer * batch = slot;
+        slot = nullptr;
+        if (batch) {
+            batch->pprev_ = &batch;
+        }
+        while (batch) {
+            WheelTimer * timer = batch;
+            unlink_(*timer);
+            // Callback may reschedule or cancel any timer.
+            timer->callback_(timer->arg_);
+        }
+    }
+
+    /**
+     * @brief Advance time by @p ticks ticks.
+     * @param[in] ticks   Number of ticks to advance.
+     */
+    auto advance(TickType ticks) -> void
+    {
+        for (TickType i = 0; i < ticks; ++i) {
+            this->tick();
+        }
+    }
+
+    /**
+     * @brief Advance time until now() equals @p tick.
+     * @note Useful with a free running hardware timer:
+     *       advanceTo(xtimer_now_usec() / TickDurationUs).
+     * @param[in] tick   Absolute tick to advance to. Handles wrap around.
+     */
+    auto advanceTo(TickType const tick) -> void
+    {
+        this->advance(tick - this->now_);
+    }
+
+    /**
+     * @brief Current tick.
+     * @returns   Number of ticks since construction.
+     */
+    auto now() const -> TickType
+    {
+        return this->now_;
+    }
+
+    /**
+     * @brief Largest delay accepted by schedule().
+     * @returns   Maximum delay in ticks.
+     */
+    static constexpr auto maxDelay() -> TickType
+    {
+        return (SlotBits * Levels == 32) ? TickType(UINT32_MAX)
+                                         : (TickType(1) << (SlotBits * Levels)) - 1;
+    }
+
+private:
+    static constexpr SizeType Slots = SizeType(1) << SlotBits;
+    static constexpr TickType Mask = Slots - 1;
+
+    /**
+     * @brief Access slot of @p level that covers @p tick.
+     * @param[in] level   Wheel level.
+     * @param[in] tick    Absolute tick.
+     * @returns           Reference to the slots list head.
+     */
+    auto slot_(SizeType const level, TickType const tick) -> WheelTimer *&
+    {
+        SizeType idx = (tick >> (SlotBits * level)) & Mask;
+        return this->slots_[level * Slots + idx];
+    }
+
+    /**
+     * @brief Insert @p timer into the slot matching its expiry.
+     * @param[in,out] timer   Timer with valid expiry.
+     */
+    auto place_(WheelTimer & timer) -> void
+    {
+        TickType delta = timer.expiry_ - this->now_;
+        SizeType level = 0;
+        while (level + 1 < Levels && delta >= (TickType(1) << (SlotBits * (level + 1)))) {
+            level += 1;
+        }
+        WheelTimer *& head = this->slot_(level, timer.expiry_);
+        timer.next_ = head;
+        if (head) {
+            head->pprev_ = &timer.next_;
+        }
+        head = &timer;
+        timer.pprev_ = &head;
+    }
+
+    /**
+     * @brief Reinsert all timers of the current slot of @p level.
+     * @param[in] level   Wheel level to cascade.
+     */
+    auto cascade_(SizeType const level) -> void
+    {
+        WheelTimer *& slot = this->slot_(level, this->now_);
+        WheelTimer * list = slot;
+        slot = nullptr;
+        while (list) {
+            WheelTimer * timer = list;
+            list = timer->next_;
+            this->place_(*timer);
+        }
+    }
+
+    /**
+     * @brief Remove @p timer from its list.
+     * @param[in,out] timer   Scheduled timer.
+     */
+    static auto unlink_(WheelTimer & timer) -> void
+    {
+        *(timer.pprev_) = timer.next_;
+        if (timer.next_) {
+            timer.next_->pprev_ = timer.pprev_;
+        }
+        timer.next_ = nullptr;
+        timer.pprev_ = nullptr;
+    }
+
+    Array<WheelTimer *, Slots * Levels> slots_;   /**< Slot list heads, level by level */
+    TickType now_;                                /**< Current tick */
+
+    // Deleted with purpose
+    TimerWheel(TimerWheel const &) = delete;
+    TimerWheel(TimerWheel const &&) = delete;
+    auto operator = (TimerWheel const &) -> TimerWheel & = delete;
+    auto operator = (TimerWheel const &&) -> TimerWheel & = delete;
+};
+
+} // namespace riot
+#endif // TIMERWHEEL_IMPL_HPP
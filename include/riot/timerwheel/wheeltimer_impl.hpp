@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Intrusive timer node managed by a TimerWheel.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef WHEELTIMER_IMPL_HPP
+#define WHEELTIMER_IMPL_HPP
+
+#include <cstdint>
+
+namespace riot
+{
+
+// Forward declaration of TimerWheel.
+template <std::size_t SlotBits, std::size_t Levels>
+class TimerWheel;
+
+/**
+ * @brief Timer scheduled on a TimerWheel. The timer carries all data the
+ *        TimerWheel needs to manage it, the TimerWheel allocates nothing.
+ * @note A WheelTimer must not be destroyed while it is scheduled.
+ */
+class WheelTimer
+{
+public:
+    // Member Types
+    typedef void (*Callback)(void * arg);
+
+    /**
+     * @brief Constructor.
+     * @param[in] callback   Function called on expiry.
+     * @param[in] arg        Argument passed to @p callback.
+     */
+    WheelTimer(Callback callback, void * arg)
+        : next_(nullptr)
+        , pprev_(nullptr)
+        , expiry_(0)
+        , callback_(callback)
+        , arg_(arg)
+    {
+    }
+
+    /**
+     * @brief Check if the timer is currently scheduled.
+     * @returns   true if the timer is scheduled.
+     */
+    auto scheduled() const -> bool
+    {
+        return this->pprev_ != nullptr;
+    }
+
+    /**
+     * @brief Tick the timer expires at. Only valid while scheduled.
+     * @returns   Absolute expiry tick.
+     */
+    auto expiry() const -> uint32_t
+    {
+        return this->expiry_;
+    }
+
+private:
+    WheelTimer * next_;    /**< Next timer in the same slot */
+    WheelTimer ** pprev_;  /**< Link pointing to this timer, nullptr if idle */
+    uint32_t expiry_;      /**< Absolute expiry tick */
+    Callback callback_;    /**< Expiry callback */
+    void * arg_;           /**< Callback argument */
+
+    template <std::size_t SlotBits, std::size_t Levels>
+    friend class TimerWheel;
+
+    // Deleted with purpose
+    WheelTimer(WheelTimer const &) = delete;
+    WheelTimer(WheelTimer const &&) = delete;
+    auto operator = (WheelTimer const &) -> WheelTimer & = delete;
+    auto operator = (WheelTimer const &&) -> WheelTimer & = delete;
+};
+
+} // namespace riot
+#endif // WHEELTIMER_IMPL_HPP
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+ /**
+  * @ingroup     riot_cpp_wrapper
+  * @{
+  *
+  * @file
+  * @brief       Lock-free triple buffer publishing the latest value.
+  *
+  * @author      Simon Brummer <simon.brummer@posteo.de>
+  *
+  * @}
+  */
+
+#ifndef TRIPLEBUFFER_IMPL_HPP
+#define TRIPLEBUFFER_IMPL_HPP
+
+#include <cstdint>
+#include <cerrno>
+
+namespace riot
+{
+
+/**
+ * @brief Lock-free publication of the latest value of type @p T from one
+ *        writer to one reader.
+ * @note Writer and reader own one buffer each, the third buffer is shared.
+ *       publish() and update() swap the own buffer with the shared one by a
+ *       single atomic exchange. Neither side blocks or waits for the other,
+ *       the writer side may run in interrupt context.
+ * @note Supports exactly one writer and one reader. Use one TripleBuffer per
+ *       reader to serve several readers.
+ */
+template <typename T>
+class TripleBuffer
+{
+public:
+    // Member Types
+    typedef T ValueType;
+    typedef T & Reference;
+    typedef T const & ConstReference;
+
+    /**
+     * @brief Default Constructor. Nothing is published.
+     */
+    TripleBuffer()
+        : shared_(1)
+        , write_(0)
+        , read_(2)
+    {
+    }
+
+    /**
+     * @brief Fill-Constructor: All buffers hold @p initValue. Nothing is published.
+     * @param[in] initValue   Value returned by front() before the first update().
+     */
+    TripleBuffer(ConstReference initValue)
+        : TripleBuffer()
+    {
+        for (uint8_t i = 0; i < 3; ++i) {
+            this->buffers_[i] = initValue;
+        }
+    }
+
+    /**
+     * @brief Writer: Publish a copy of @p src.
+     * @note Never blocks. A value not yet taken by the reader is replaced.
+     * @param[in] src   Value to publish.
+     */
+    auto write(ConstReference src) -> void
+    {
+        this->buffers_[this->write_] = src;
+        this->publish();
+    }
+
+    /**
+     * @brief Writer: Access the buffer owned by the writer. Fill it in place
+     *        and publish() it afterwards.
+     * @returns   Reference to the writer buffer.
+     */
+    auto back() -> Reference
+    {
+        return this->buffers_[this->write_];
+    }
+
+    /**
+     * @brief Writer: Publish the writer buffer. The writer continues with
+     *        the previously shared buffer.
+     */
+    auto publish() -> void
+    {
+        uint8_t old = __atomic_exchange_n(&this->shared_, static_cast<uint8_t>(this->write_ | Fresh),
+                                          __ATOMIC_ACQ_REL);
+        this->write_ = old & IndexMask;
+    }
+
+    /**
+     * @brief Reader: Take the most recently published value, if there is one.
+     * @returns   Zero if a value was published since the last update().
+     *            -EAGAIN if no value was published. front() is unchanged.
+     */
+    auto update() -> int
+    {
+        if ((__atomic_load_n(&this->shared_, __ATOMIC_ACQUIRE) & Fresh) == 0) {
+            return -EAGAIN;
+        }
+        uint8_t old = __atomic_exchange_n(&this->shared_, this->read_, __ATOMIC_ACQ_REL);
+        this->read_ = old & IndexMask;
+        return 0;
+    }
+
+    /**
+     * @brief Reader: Access the value taken by the last update().
+     * @note Stays valid and unchanged until the next update().
+     * @returns   Reference to the reader buffer.
+     */
+    auto front() const -> ConstReference
+    {
+        return this->buffers_[this->read_];
+    }
+
+    /**
+     * @brief Reader: Copy the most recently published value.
+     * @param[out] dst   Latest complete value.
+     * @returns   Zero if a value was published since the last read.
+     *            -EAGAIN if no value was published. @p dst is assigned
+     *            the previous value again.
+     */
+    auto read(Reference dst) -> int
+    {
+        int ret = this->update();
+        dst = this->front();
+        return ret;
+    }
+
+    /**
+     * @brief Check if a value was published since the last update().
+     * @returns   non-zero if update() returns a new value.
+     *            zero otherwise.
+     */
+    auto fresh() const -> int
+    {
+        return (__atomic_load_n(&this->shared_, __ATOMIC_ACQUIRE) & Fresh) != 0;
+    }
+
+    // Deleted with purpose
+    TripleBuffer(TripleBuffer const &) = delete;
+    TripleBuffer(TripleBuffer const &&) = delete;
+    auto operator = (TripleBuffer const &) -> TripleBuffer & = delete;
+    auto operator = (TripleBuffer const &&) -> TripleBuffer & = delete;
+
+private:
+    static constexpr uint8_t IndexMask = 0x03; /**< Buffer index bits of shared_ */
+    static constexpr uint8_t Fresh = 0x04;     /**< shared_ holds an unread value */
+
+    ValueType buffers_[3]; /**< Writer, shared and reader buffer */
+    uint8_t shared_;       /**< Index of the shared buffer and Fresh flag */
+    uint8_t write_;        /**< Index of the writer buffer */
+    uint8_t read_;         /**< Index of the reader buffer */
+};
+
+} // namespace riot
+#endif // TRIPLEBUFFER_IMPL_HPP
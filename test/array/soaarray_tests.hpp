@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef SOAARRAY_TESTS_HPP
+#define SOAARRAY_TESTS_HPP
+
+#include "../testobj.hpp"
+#include "riot/array.hpp"
+
+// Record layout of TestObj, stored field by field.
+typedef riot::SoAArray<3, uint8_t, uint16_t, uint32_t> TestSoA;
+
+// Test Constructor. Expected behavoir: The init constructor initializes
+// every record with the given field values.
+auto soaArrayTestInitConstructor(size_t& succeededTests, size_t& failedTests) -> void
+{
+    TestSoA a(1, 2, 3);
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].get<0>() != 1 || a[i].get<1>() != 2 || a[i].get<2>() != 3) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (a[i].get<0>() != 1 || a[i].get<1>() != 2 || a[i].get<2>() != 3)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test record access. Expected behavoir: assign() and load() write and read
+// all fields of a record, get<I>() references a single field. Assigning
+// a proxy copies the whole record.
+auto soaArrayTestRecordAccess(size_t& succeededTests, size_t& failedTests) -> void
+{
+    TestSoA a(0, 0, 0);
+    TestObj obj(4, 5, 6);
+    a[1].assign(obj.u8, obj.u16, obj.u32);
+    a[1].get<2>() = 7;
+    TestObj ret;
+    a[1].load(ret.u8, ret.u16, ret.u32);
+    if (ret != TestObj(4, 5, 7)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (ret != TestObj(4, 5, 7))\n");
+        failedTests += 1;
+        return;
+    }
+    a[2] = a[1];
+    TestSoA const & c = a;
+    c[2].load(ret.u8, ret.u16, ret.u32);
+    if (ret != TestObj(4, 5, 7) || c[0].get<0>() != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (ret != TestObj(4, 5, 7) || c[0].get<0>() != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test field(). Expected behavoir: Returns the Array storing a single field.
+// Its iterators visit this field of every record.
+auto soaArrayTestField(size_t& succeededTests, size_t& failedTests) -> void
+{
+    TestSoA a;
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i].assign(i, i * 10, i * 100);
+    }
+    uint32_t sum = 0;
+    for (TestSoA::FieldArray<2>::Iterator it = a.field<2>().begin(); it != a.field<2>().end(); ++it) {
+        sum += *it;
+    }
+    if (sum != 300 || a.field<1>()[2] != 20 || a.field<0>().size() != 3) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sum != 300 || a.field<1>()[2] != 20 || a.field<0>().size() != 3)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test fill(). Expected behavoir: Overrides every record with the given values.
+auto soaArrayTestFill(size_t& succeededTests, size_t& failedTests) -> void
+{
+    TestSoA a(1, 2, 3);
+    a.fill(4, 5, 6);
+    TestObj ret;
+    a[2].load(ret.u8, ret.u16, ret.u32);
+    if (ret != TestObj(4, 5, 6)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (ret != TestObj(4, 5, 6))\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all SoAArray Tests
+auto runSoAArrayTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    soaArrayTestInitConstructor(succeededTests, failedTests);
+    soaArrayTestRecordAccess(succeededTests, failedTests);
+    soaArrayTestField(succeededTests, failedTests);
+    soaArrayTestFill(succeededTests, failedTests);
+}
+
+#endif // SOAARRAY_TESTS_HPP
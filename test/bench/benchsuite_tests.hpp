@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BENCHSUITE_TESTS_HPP
+#define BENCHSUITE_TESTS_HPP
+
+#include "riot/bench.hpp"
+
+// Benchmark function used in tests. Counts executed iterations in @p arg.
+auto benchSuiteTestFunction(void * arg, uint32_t iterations) -> void
+{
+    uint32_t * counter = static_cast<uint32_t *>(arg);
+    for (uint32_t i = 0; i < iterations; ++i) {
+        *counter += 1;
+        riot::doNotOptimize(*counter);
+    }
+}
+
+// Test add(). Expected behavoir: Cases are registered until MaxCases is
+// reached, invalid arguments are rejected.
+auto benchSuiteTestAdd(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::BenchSuite<2> suite;
+    if (suite.add(nullptr, benchSuiteTestFunction) != -EINVAL || suite.add("a", nullptr) != -EINVAL) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (suite.add(nullptr, benchSuiteTestFunction) != -EINVAL || suite.add(\"a\", nullptr) != -EINVAL)\n");
+        failedTests += 1;
+        return;
+    }
+    if (suite.add("a", benchSuiteTestFunction) != 0 || suite.add("b", benchSuiteTestFunction) != 0 ||
+        suite.add("c", benchSuiteTestFunction) != -ENOMEM || suite.size() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (suite.add(\"a\", ...) != 0 || suite.add(\"b\", ...) != 0 || suite.add(\"c\", ...) != -ENOMEM || suite.size() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test run(). Expected behavoir: The case is calibrated and executed
+// iterations times per sample, statistics are ordered.
+auto benchSuiteTestRun(size_t& succeededTests, size_t& failedTests) -> void
+{
+    uint32_t counter = 0;
+    riot::BenchSuite<1, 5> suite(100);
+    riot::BenchResult result;
+    suite.add("count", benchSuiteTestFunction, &counter);
+    if (suite.run(1, result) != -EINVAL || suite.run(0, result) != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (suite.run(1, result) != -EINVAL || suite.run(0, result) != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    if (result.iterations == 0 || result.samples != 5 || counter < result.iterations * 5) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (result.iterations == 0 || result.samples != 5 || counter < result.iterations * 5)\n");
+        failedTests += 1;
+        return;
+    }
+    if (result.min > result.median || result.min > result.mean) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (result.min > result.median || result.min > result.mean)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test statistic helpers. Expected behavoir: Values are sorted ascending,
+// integer square root is floored.
+auto benchSuiteTestStatistics(size_t& succeededTests, size_t& failedTests) -> void
+{
+    uint64_t values[] = {5, 1, 4, 2, 3};
+    riot::keepout::benchSort(values, 5);
+    if (values[0] != 1 || values[2] != 3 || values[4] != 5) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (values[0] != 1 || values[2] != 3 || values[4] != 5)\n");
+        failedTests += 1;
+        return;
+    }
+    if (riot::keepout::benchSqrt(0) != 0 || riot::keepout::benchSqrt(15) != 3 ||
+        riot::keepout::benchSqrt(16) != 4 || riot::keepout::benchSqrt(1000000000000ULL) != 1000000) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (benchSqrt(0) != 0 || benchSqrt(15) != 3 || benchSqrt(16) != 4 || benchSqrt(10^12) != 10^6)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all BenchSuite tests
+auto runBenchSuiteTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    benchSuiteTestAdd(succeededTests, failedTests);
+    benchSuiteTestRun(succeededTests, failedTests);
+    benchSuiteTestStatistics(succeededTests, failedTests);
+}
+
+#endif // BENCHSUITE_TESTS_HPP
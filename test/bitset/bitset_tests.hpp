@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BITSET_TESTS_HPP
+#define BITSET_TESTS_HPP
+
+#include "riot/bitset.hpp"
+
+// Test Constructor. Expected behavoir: All bits are reset.
+auto bitsetTestDefaultConstructor(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Bitset<70> b;
+    if (b.any() || !b.none() || b.count() != 0 || b.size() != 70) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (b.any() || !b.none() || b.count() != 0 || b.size() != 70)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test set(), reset(), flip() and test(). Expected behavoir: Single bits are
+// modified, out of range positions return -EINVAL and test() false.
+auto bitsetTestSetReset(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Bitset<70> b;
+    if (b.set(0) != 0 || b.set(33) != 0 || b.set(69) != 0 || b.set(70) != -EINVAL) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (b.set(0) != 0 || b.set(33) != 0 || b.set(69) != 0 || b.set(70) != -EINVAL)\n");
+        failedTests += 1;
+        return;
+    }
+    if (!b.test(0) || !b.test(33) || !b.test(69) || b.test(1) || b.test(70)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!b.test(0) || !b.test(33) || !b.test(69) || b.test(1) || b.test(70))\n");
+        failedTests += 1;
+        return;
+    }
+    b.reset(33);
+    b.flip(0);
+    b.flip(1);
+    if (b.test(33) || b.test(0) || !b.test(1) || b.reset(70) != -EINVAL || b.flip(70) != -EINVAL) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (b.test(33) || b.test(0) || !b.test(1) || b.reset(70) != -EINVAL || b.flip(70) != -EINVAL)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test setAll(), resetAll(), flipAll() and count(). Expected behavoir: Only
+// the N bits of the bitset are affected.
+auto bitsetTestAll(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Bitset<70> b;
+    b.setAll();
+    if (!b.all() || b.count() != 70) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!b.all() || b.count() != 70)\n");
+        failedTests += 1;
+        return;
+    }
+    b.reset(5);
+    b.flipAll();
+    if (b.count() != 1 || !b.test(5)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (b.count() != 1 || !b.test(5))\n");
+        failedTests += 1;
+        return;
+    }
+    b.resetAll();
+    if (!b.none()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!b.none())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test findFirst(), findNext() and findLast(). Expected behavoir: Return
+// the index of the matching set bit, size() if there is none.
+auto bitsetTestFind(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Bitset<70> b;
+    if (b.findFirst() != 70 || b.findLast() != 70) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (b.findFirst() != 70 || b.findLast() != 70)\n");
+        failedTests += 1;
+        return;
+    }
+    b.set(3);
+    b.set(40);
+    b.set(68);
+    if (b.findFirst() != 3 || b.findNext(3) != 40 || b.findNext(40) != 68 ||
+        b.findNext(68) != 70 || b.findLast() != 68) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (b.findFirst() != 3 || b.findNext(3) != 40 || b.findNext(40) != 68 || "
+               "b.findNext(68) != 70 || b.findLast() != 68)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test findFirstReset() and findNextReset(). Expected behavoir: Return the index
+// of the matching reset bit, size() if all bits are set.
+auto bitsetTestFindReset(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Bitset<70> b;
+    b.setAll();
+    if (b.findFirstReset() != 70) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (b.findFirstReset() != 70)\n");
+        failedTests += 1;
+        return;
+    }
+    b.reset(35);
+    b.reset(36);
+    if (b.findFirstReset() != 35 || b.findNextReset(35) != 36 || b.findNextReset(36) != 70) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (b.findFirstReset() != 35 || b.findNextReset(35) != 36 || b.findNextReset(36) != 70)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test bitwise operators. Expected behavoir: and, or, xor and not operate
+// on all bits. == compares all bits.
+auto bitsetTestOperators(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Bitset<40> a;
+    riot::Bitset<40> b;
+    a.set(1);
+    a.set(35);
+    b.set(35);
+    b.set(39);
+    if ((a & b).count() != 1 || (a | b).count() != 3 || (a ^ b).count() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: ((a & b).count() != 1 || (a | b).count() != 3 || (a ^ b).count() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    if ((~a).count() != 38 || (~a).test(35) || a == b || !(a == a) || (a ^ a) != riot::Bitset<40>()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: ((~a).count() != 38 || (~a).test(35) || a == b || !(a == a) || (a ^ a) != riot::Bitset<40>())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all Bitset Tests
+auto runBitsetTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    bitsetTestDefaultConstructor(succeededTests, failedTests);
+    bitsetTestSetReset(succeededTests, failedTests);
+    bitsetTestAll(succeededTests, failedTests);
+    bitsetTestFind(succeededTests, failedTests);
+    bitsetTestFindReset(succeededTests, failedTests);
+    bitsetTestOperators(succeededTests, failedTests);
+}
+
+#endif // BITSET_TESTS_HPP
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef COROUTINE_TESTS_HPP
+#define COROUTINE_TESTS_HPP
+
+#include "riot/ringbuffer.hpp"
+#include "riot/coroutine.hpp"
+
+typedef riot::BlockingRingbuffer<int, 2, riot::Ringbuffer<int, 2>, riot::Mutex,
+                                 riot::WatchableSemaphore> CoroutineTestQueue;
+
+auto coroutineTestProducer(riot::TaskMemory &, CoroutineTestQueue & queue, int n) -> riot::Task
+{
+    for (int i = 1; i <= n; ++i) {
+        co_await riot::asyncAdd(queue, i);
+    }
+}
+
+auto coroutineTestConsumer(riot::TaskMemory &, CoroutineTestQueue & queue, int n, int & sum) -> riot::Task
+{
+    for (int i = 0; i < n; ++i) {
+        int value = 0;
+        int err = co_await riot::asyncGet(queue, value);
+        if (err == 0) {
+            sum += value;
+        }
+    }
+}
+
+auto coroutineTestWaiter(riot::TaskMemory &, riot::WatchableSemaphore & sema, int & woken) -> riot::Task
+{
+    for (;;) {
+        int err = co_await riot::asyncWait(sema);
+        if (err != 0) {
+            break;
+        }
+        woken += 1;
+    }
+}
+
+auto coroutineTestPoster(riot::TaskMemory &, riot::WatchableSemaphore & sema) -> riot::Task
+{
+    sema.post();
+    sema.post();
+    co_return;
+}
+
+// Test producer and consumer Task sharing one thread. Expected behavior:
+// Both Tasks wait on the small queue in turn, run() returns after all
+// elements were transferred and the frames are released.
+auto coroutineTestQueue(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::TaskFrame<256> consumerFrame;
+    riot::TaskFrame<256> producerFrame;
+    riot::Executor exec;
+    CoroutineTestQueue queue;
+    int sum = 0;
+    riot::Task consumer = coroutineTestConsumer(consumerFrame, queue, 10, sum);
+    riot::Task producer = coroutineTestProducer(producerFrame, queue, 10);
+    if (exec.spawn(consumer) != 0 || exec.spawn(producer) != 0 || consumer.valid() ||
+        !consumerFrame.used()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (exec.spawn(consumer) != 0 || ... || !consumerFrame.used())\n");
+        failedTests += 1;
+        return;
+    }
+    exec.run();
+    if (sum != 55 || !queue.empty() || consumerFrame.used() || producerFrame.used()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sum != 55 || !queue.empty() || consumerFrame.used() || producerFrame.used())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test asyncWait() and frame allocation. Expected behavior: A waiting Task
+// is resumed once per post. Frames larger than their TaskMemory and a
+// TaskMemory in use are rejected with -ENOMEM. Executor destroys unfinished
+// Tasks.
+auto coroutineTestSemaphore(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::TaskFrame<8> tinyFrame;
+    riot::TaskFrame<256> waiterFrame;
+    riot::TaskFrame<256> posterFrame;
+    riot::WatchableSemaphore sema(0);
+    int woken = 0;
+    {
+        riot::Executor exec;
+        riot::Task tiny = coroutineTestPoster(tinyFrame, sema);
+        riot::Task waiter = coroutineTestWaiter(waiterFrame, sema, woken);
+        riot::Task again = coroutineTestPoster(waiterFrame, sema);
+        if (exec.spawn(tiny) != -ENOMEM || exec.spawn(again) != -ENOMEM || exec.spawn(waiter) != 0 ||
+            exec.runOnce() != 1 || woken != 0) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (exec.spawn(tiny) != -ENOMEM || ... || woken != 0)\n");
+            failedTests += 1;
+            return;
+        }
+        riot::Task poster = coroutineTestPoster(posterFrame, sema);
+        exec.spawn(poster);
+        exec.runOnce();
+        exec.runOnce();
+        if (woken != 2 || posterFrame.used() || !waiterFrame.used()) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (woken != 2 || posterFrame.used() || !waiterFrame.used())\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    if (waiterFrame.used()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (waiterFrame.used())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all Coroutine Tests
+auto runCoroutineTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    coroutineTestQueue(succeededTests, failedTests);
+    coroutineTestSemaphore(succeededTests, failedTests);
+}
+
+#endif // COROUTINE_TESTS_HPP
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef STATICHASHMAP_TESTS_HPP
+#define STATICHASHMAP_TESTS_HPP
+
+#include "../testobj.hpp"
+#include "riot/hashmap.hpp"
+
+// Hash function object mapping every key to the same slot. Forces collisions.
+class CollidingHash
+{
+public:
+    auto operator () (int const & key) const -> uint32_t
+    {
+        (void) key;
+        return 0;
+    }
+};
+
+// Test Constructor. Expected behavoir: Create empty hashmap.
+auto staticHashMapTestDefaultConstructor(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::StaticHashMap<int, TestObj, 4> map;
+    if (!map.empty() || map.size() != 0 || map.capacity() != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!map.empty() || map.size() != 0 || map.capacity() != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test insert(). Expected behavoir: Insert returns zero for new keys,
+// -EEXIST for already stored keys and -ENOMEM if the hashmap is full.
+auto staticHashMapTestInsert(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::StaticHashMap<int, TestObj, 2> map;
+    if (map.insert(1, TestObj(1,2,3)) != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.insert(1, TestObj(1,2,3)) != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    if (map.insert(1, TestObj(4,5,6)) != -EEXIST) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.insert(1, TestObj(4,5,6)) != -EEXIST)\n");
+        failedTests += 1;
+        return;
+    }
+    map.insert(2, TestObj(4,5,6));
+    if (map.insert(3, TestObj(7,8,9)) != -ENOMEM || !map.full()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.insert(3, TestObj(7,8,9)) != -ENOMEM || !map.full())\n");
+        failedTests += 1;
+        return;
+    }
+    TestObj ret;
+    map.find(1, ret);
+    if (ret != TestObj(1,2,3) || map.size() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (ret != TestObj(1,2,3) || map.size() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test assign(). Expected behavoir: Insert new keys, overwrite values of
+// stored keys. -ENOMEM if a new key does not fit.
+auto staticHashMapTestAssign(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::StaticHashMap<int, TestObj, 1> map;
+    map.assign(1, TestObj(1,2,3));
+    if (map.assign(1, TestObj(4,5,6)) != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.assign(1, TestObj(4,5,6)) != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    TestObj ret;
+    map.find(1, ret);
+    if (ret != TestObj(4,5,6)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (ret != TestObj(4,5,6))\n");
+        failedTests += 1;
+        return;
+    }
+    if (map.assign(2, TestObj(7,8,9)) != -ENOMEM) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.assign(2, TestObj(7,8,9)) != -ENOMEM)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test find(). Expected behavoir: Return zero and assign value of stored keys,
+// -ENOENT for unknown keys. The iterator version returns end() for unknown keys.
+auto staticHashMapTestFind(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::StaticHashMap<int, TestObj, 4> map;
+    map.insert(23, TestObj(1,2,3));
+    TestObj ret;
+    if (map.find(23, ret) != 0 || ret != TestObj(1,2,3)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.find(23, ret) != 0 || ret != TestObj(1,2,3))\n");
+        failedTests += 1;
+        return;
+    }
+    if (map.find(42, ret) != -ENOENT || map.contains(42)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.find(42, ret) != -ENOENT || map.contains(42))\n");
+        failedTests += 1;
+        return;
+    }
+    if (map.find(42) != map.end() || map.find(23)->value != TestObj(1,2,3)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.find(42) != map.end() || map.find(23)->value != TestObj(1,2,3))\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test erase(). Expected behavoir: Remove stored keys and return zero,
+// -ENOENT for unknown keys. Colliding keys stored behind the removed
+// key must still be found (backward shift deletion).
+auto staticHashMapTestErase(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::StaticHashMap<int, int, 4, CollidingHash> map;
+    map.insert(1, 10);
+    map.insert(2, 20);
+    map.insert(3, 30);
+    if (map.erase(1) != 0 || map.erase(1) != -ENOENT || map.size() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.erase(1) != 0 || map.erase(1) != -ENOENT || map.size() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    int ret2 = 0;
+    int ret3 = 0;
+    if (map.find(2, ret2) != 0 || map.find(3, ret3) != 0 || ret2 != 20 || ret3 != 30) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.find(2, ret2) != 0 || map.find(3, ret3) != 0 || ret2 != 20 || ret3 != 30)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test robin hood probing. Expected behavoir: All keys remain accessible
+// after filling the hashmap completely and removing keys in between.
+auto staticHashMapTestProbing(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::StaticHashMap<int, int, 16> map;
+    for (int i = 0; i < 16; ++i) {
+        map.insert(i * 7, i);
+    }
+    for (int i = 0; i < 16; i += 2) {
+        map.erase(i * 7);
+    }
+    for (int i = 0; i < 16; ++i) {
+        int ret = 0;
+        int err = map.find(i * 7, ret);
+        if ((i % 2 == 0 && err != -ENOENT) || (i % 2 == 1 && (err != 0 || ret != i))) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: key %d lookup failed\n", i * 7);
+            failedTests += 1;
+            return;
+        }
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test iterators. Expected behavoir: Iterators visit every stored entry once.
+// The ReverseIterator visits the same entries in opposite order.
+auto staticHashMapTestIterators(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::StaticHashMap<int, int, 8> map;
+    if (map.begin() != map.end() || map.rbegin() != map.rend()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (map.begin() != map.end() || map.rbegin() != map.rend())\n");
+        failedTests += 1;
+        return;
+    }
+    map.insert(1, 1);
+    map.insert(2, 2);
+    map.insert(3, 3);
+    int sum = 0;
+    int count = 0;
+    for (riot::StaticHashMap<int, int, 8>::Iterator it = map.begin(); it != map.end(); ++it) {
+        sum += it->value;
+        count += 1;
+    }
+    int first = map.begin()->value;
+    int rsum = 0;
+    int last = 0;
+    for (riot::StaticHashMap<int, int, 8>::ConstReverseIterator it = map.crbegin(); it != map.crend(); ++it) {
+        rsum += (*it).value;
+        last = it->value;
+    }
+    if (sum != 6 || count != 3 || rsum != 6 || first != last) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sum != 6 || count != 3 || rsum != 6 || first != last)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test clear(). Expected behavoir: Remove all entries.
+auto staticHashMapTestClear(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::StaticHashMap<int, int, 4> map;
+    map.insert(1, 1);
+    map.insert(2, 2);
+    map.clear();
+    if (!map.empty() || map.contains(1) || map.cbegin() != map.cend()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!map.empty() || map.contains(1) || map.cbegin() != map.cend())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all StaticHashMap Tests
+auto runStaticHashMapTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    staticHashMapTestDefaultConstructor(succeededTests, failedTests);
+    staticHashMapTestInsert(succeededTests, failedTests);
+    staticHashMapTestAssign(succeededTests, failedTests);
+    staticHashMapTestFind(succeededTests, failedTests);
+    staticHashMapTestErase(succeededTests, failedTests);
+    staticHashMapTestProbing(succeededTests, failedTests);
+    staticHashMapTestIterators(succeededTests, failedTests);
+    staticHashMapTestClear(succeededTests, failedTests);
+}
+
+#endif // STATICHASHMAP_TESTS_HPP
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef HISTOGRAM_TESTS_HPP
+#define HISTOGRAM_TESTS_HPP
+
+#include "riot/histogram.hpp"
+
+// Test bucket mapping. Expected behavoir: Values below 2^SubBucketBits get
+// a bucket each, every power of two range is split into 2^SubBucketBits
+// buckets. Bucket bounds are consistent with bucket().
+auto histogramTestBuckets(size_t& succeededTests, size_t& failedTests) -> void
+{
+    typedef riot::Histogram<64, 2> Hist;
+    if (Hist::bucket(0) != 0 || Hist::bucket(3) != 3 || Hist::bucket(4) != 4 ||
+        Hist::bucket(7) != 7 || Hist::bucket(8) != 8 || Hist::bucket(9) != 8 ||
+        Hist::bucket(10) != 9 || Hist::bucket(UINT64_MAX) != 63) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (Hist::bucket(0) != 0 || ... || Hist::bucket(UINT64_MAX) != 63)\n");
+        failedTests += 1;
+        return;
+    }
+    for (size_t i = 0; i + 1 < Hist::buckets(); ++i) {
+        if (Hist::bucket(Hist::lowerBound(i)) != i || Hist::bucket(Hist::upperBound(i)) != i) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (Hist::bucket(Hist::lowerBound(i)) != i || Hist::bucket(Hist::upperBound(i)) != i)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test record() and quantile(). Expected behavoir: Counters, min and max are
+// updated, quantiles are within the relative error of a bucket.
+auto histogramTestQuantile(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Histogram<128, 3> hist;
+    if (hist.quantile(500) != 0 || hist.min() != 0 || hist.max() != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (hist.quantile(500) != 0 || hist.min() != 0 || hist.max() != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    for (uint32_t i = 1; i <= 1000; ++i) {
+        hist.record(i);
+    }
+    uint64_t p50 = hist.quantile(500);
+    uint64_t p99 = hist.quantile(990);
+    if (hist.samples() != 1000 || hist.min() != 1 || hist.max() != 1000 ||
+        p50 < 500 || p50 > 500 + 500 / 8 || p99 < 990 || p99 > 1000 ||
+        hist.quantile(1000) != 1000) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (hist.samples() != 1000 || hist.min() != 1 || hist.max() != 1000 || quantiles out of range)\n");
+        failedTests += 1;
+        return;
+    }
+    hist.reset();
+    if (hist.samples() != 0 || hist.count(riot::Histogram<128, 3>::bucket(500)) != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (hist.samples() != 0 || hist.count(bucket(500)) != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test merge(). Expected behavoir: Merged histogram equals a histogram that
+// recorded all values.
+auto histogramTestMerge(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Histogram<64> a;
+    riot::Histogram<64> b;
+    riot::Histogram<64> all;
+    for (uint32_t i = 0; i < 100; ++i) {
+        a.record(i);
+        b.record(i * 1000 + 7, 2);
+        all.record(i);
+        all.record(i * 1000 + 7, 2);
+    }
+    a.merge(b);
+    if (a != all || a.samples() != 300 || a.min() != 0 || a.max() != 99007) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (a != all || a.samples() != 300 || a.min() != 0 || a.max() != 99007)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test serialize() and deserialize(). Expected behavoir: Roundtrip restores
+// the histogram, small buffers and mismatching data are rejected.
+auto histogramTestSerialize(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Histogram<96, 2> hist;
+    riot::Histogram<96, 2> copy;
+    riot::Histogram<64, 2> other;
+    uint8_t buf[riot::Histogram<96, 2>::maxSerializedSize()];
+    hist.record(3);
+    hist.record(1000000, 5);
+    hist.record(UINT64_MAX);
+
+    int len = hist.serialize(buf, sizeof(buf));
+    if (len <= 0 || len > 40 || copy.deserialize(buf, len) != 0 || copy != hist) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (len <= 0 || len > 40 || copy.deserialize(buf, len) != 0 || copy != hist)\n");
+        failedTests += 1;
+        return;
+    }
+    if (hist.serialize(buf, 8) != -ENOBUFS || copy.deserialize(buf, len - 1) != -EINVAL ||
+        copy.samples() != 0 || other.deserialize(buf, len) != -EINVAL) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (hist.serialize(buf, 8) != -ENOBUFS || copy.deserialize(buf, len - 1) != -EINVAL || copy.samples() != 0 || other.deserialize(buf, len) != -EINVAL)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all Histogram tests
+auto runHistogramTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    histogramTestBuckets(succeededTests, failedTests);
+    histogramTestQuantile(succeededTests, failedTests);
+    histogramTestMerge(succeededTests, failedTests);
+    histogramTestSerialize(succeededTests, failedTests);
+}
+
+#endif // HISTOGRAM_TESTS_HPP
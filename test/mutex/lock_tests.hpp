@@ -11,12 +11,14 @@
 
 #include "lockinterface_tests.hpp"
 #include "lockguard_tests.hpp"
+#include "seqlock_tests.hpp"
 
 // Run all Lock specific tests
 auto runLockTests(size_t& succeededTests, size_t& failedTests) -> void
 {
     runLockInterfaceTests(succeededTests, failedTests);
     runLockGuardTests(succeededTests, failedTests);
+    runSeqLockTests(succeededTests, failedTests);
 }
 
 #endif // LOCK_TESTS_HPP
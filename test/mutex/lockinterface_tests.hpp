@@ -38,11 +38,25 @@ auto lockInterfaceTestMutex(size_t& succeededTests, size_t& failedTests) -> void
     succeededTests += 1;
 }
 
+// This Test checks if the supplied IrqLock complies to LockGuard interface.
+// This test can't fail but the tests can not compile...
+auto lockInterfaceTestIrqLock(size_t& succeededTests, size_t& failedTests) -> void
+{
+    (void) failedTests;
+
+    riot::IrqLock l;
+    riot::LockGuard<riot::IrqLock> g(l);
+
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
 // Run all LockInterface tests
 auto runLockInterfaceTests(size_t& succeededTests, size_t& failedTests) -> void
 {
     lockInterfaceTestLockDummy(succeededTests, failedTests);
     lockInterfaceTestMutex(succeededTests, failedTests);
+    lockInterfaceTestIrqLock(succeededTests, failedTests);
 }
 
 #endif // LOCKINTERFACE_TESTS_HPP
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef SEQLOCK_TESTS_HPP
+#define SEQLOCK_TESTS_HPP
+
+#include "riot/mutex.hpp"
+#include "../testlock.hpp"
+
+class SeqLockTestValue
+{
+public:
+    uint32_t a;
+    uint32_t b;
+};
+
+// Expected Behavior: write() updates the value under the writer lock and
+// advances the sequence by two. read() returns the written value.
+auto seqLockTestWriteRead(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::SeqLock<SeqLockTestValue> seqLock({1, 2});
+    SeqLockTestValue out = {0, 0};
+    seqLock.read(out);
+    if (out.a != 1 || out.b != 2 || seqLock.sequence() != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (out.a != 1 || out.b != 2 || seqLock.sequence() != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    seqLock.write({3, 4});
+    if (seqLock.tryRead(out) != 0 || out.a != 3 || out.b != 4 || seqLock.sequence() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (seqLock.tryRead(out) != 0 || out.a != 3 || out.b != 4 || seqLock.sequence() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Expected Behavior: SeqLock complies to the LockGuard interface. While the
+// guard is held, readers fail with -EAGAIN. The writer lock is taken once.
+auto seqLockTestLockGuard(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::SeqLock<SeqLockTestValue, TestLock> seqLock;
+    SeqLockTestValue out = {0, 0};
+    {
+        riot::LockGuard<riot::SeqLock<SeqLockTestValue, TestLock>> g(seqLock);
+        seqLock.value().a = 5;
+        if (seqLock.tryRead(out) != -EAGAIN || seqLock.sequence() != 1) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (seqLock.tryRead(out) != -EAGAIN || seqLock.sequence() != 1)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    if (seqLock.tryRead(out) != 0 || out.a != 5 || out.b != 0 || seqLock.sequence() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (seqLock.tryRead(out) != 0 || out.a != 5 || out.b != 0 || seqLock.sequence() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all SeqLock tests
+auto runSeqLockTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    seqLockTestWriteRead(succeededTests, failedTests);
+    seqLockTestLockGuard(succeededTests, failedTests);
+}
+
+#endif // SEQLOCK_TESTS_HPP
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef PRIORITYQUEUE_TESTS_HPP
+#define PRIORITYQUEUE_TESTS_HPP
+
+#include "riot/priorityqueue.hpp"
+
+// Test Constructor. Expected behavoir: Create empty priority queue.
+auto priorityQueueTestDefaultConstructor(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::PriorityQueue<int, 4> pq;
+    if (!pq.empty() || pq.size() != 0 || pq.capacity() != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!pq.empty() || pq.size() != 0 || pq.capacity() != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test push(). Expected behavoir: Zero if the element was added,
+// -ENOMEM if the priority queue is full.
+auto priorityQueueTestPush(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::PriorityQueue<int, 2> pq;
+    if (pq.push(1) != 0 || pq.push(2) != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pq.push(1) != 0 || pq.push(2) != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    if (pq.push(3) != -ENOMEM || !pq.full()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pq.push(3) != -ENOMEM || !pq.full())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test top() and pop(). Expected behavoir: Elements are removed in
+// priority order. On an empty priority queue -ENOENT is returned.
+template <std::size_t Arity>
+auto priorityQueueTestPop(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::PriorityQueue<int, 8, riot::Less<int>, Arity> pq;
+    int values[8] = {5, 3, 8, 1, 7, 2, 6, 4};
+    for (int i = 0; i < 8; ++i) {
+        pq.push(values[i]);
+    }
+    for (int i = 1; i <= 8; ++i) {
+        int ret = 0;
+        if (pq.top() != i || pq.pop(ret) != 0 || ret != i) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (pq.top() != i || pq.pop(ret) != 0 || ret != i)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    int ret = 0;
+    if (pq.pop(ret) != -ENOENT || pq.pop() != -ENOENT || pq.top(ret) != -ENOENT) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pq.pop(ret) != -ENOENT || pq.pop() != -ENOENT || pq.top(ret) != -ENOENT)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test Compare. Expected behavoir: With Greater the largest element is on top.
+auto priorityQueueTestCompare(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::PriorityQueue<int, 4, riot::Greater<int> > pq;
+    pq.push(1);
+    pq.push(3);
+    pq.push(2);
+    if (pq.top() != 3) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pq.top() != 3)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test update(). Expected behavoir: Changing an element via its handle
+// restores heap order in both directions. Unused handles return -EINVAL.
+auto priorityQueueTestUpdate(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::PriorityQueue<int, 4> pq;
+    riot::PriorityQueue<int, 4>::Handle h1;
+    riot::PriorityQueue<int, 4>::Handle h2;
+    pq.push(10, h1);
+    pq.push(20, h2);
+    pq.push(30);
+    // Decrease key: h2 moves to top
+    if (pq.update(h2, 5) != 0 || pq.top() != 5 || pq.get(h2) != 5) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pq.update(h2, 5) != 0 || pq.top() != 5 || pq.get(h2) != 5)\n");
+        failedTests += 1;
+        return;
+    }
+    // Increase key: h2 moves to bottom
+    pq.update(h2, 40);
+    if (pq.top() != 10) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pq.top() != 10)\n");
+        failedTests += 1;
+        return;
+    }
+    pq.pop();
+    if (pq.contains(h1) || pq.update(h1, 1) != -EINVAL) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pq.contains(h1) || pq.update(h1, 1) != -EINVAL)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test erase(). Expected behavoir: Removes the element identified by a handle.
+// The remaining elements keep their order.
+auto priorityQueueTestErase(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::PriorityQueue<int, 4> pq;
+    riot::PriorityQueue<int, 4>::Handle h;
+    pq.push(2);
+    pq.push(1, h);
+    pq.push(3);
+    if (pq.erase(h) != 0 || pq.erase(h) != -EINVAL || pq.size() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pq.erase(h) != 0 || pq.erase(h) != -EINVAL || pq.size() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    int ret1 = 0;
+    int ret2 = 0;
+    pq.pop(ret1);
+    pq.pop(ret2);
+    if (ret1 != 2 || ret2 != 3) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (ret1 != 2 || ret2 != 3)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test clear(). Expected behavoir: Removes all elements.
+auto priorityQueueTestClear(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::PriorityQueue<int, 4> pq;
+    pq.push(1);
+    pq.push(2);
+    pq.clear();
+    if (!pq.empty() || pq.push(3) != 0 || pq.top() != 3) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!pq.empty() || pq.push(3) != 0 || pq.top() != 3)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all PriorityQueue Tests
+auto runPriorityQueueTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    priorityQueueTestDefaultConstructor(succeededTests, failedTests);
+    priorityQueueTestPush(succeededTests, failedTests);
+    priorityQueueTestPop<2>(succeededTests, failedTests);
+    priorityQueueTestPop<4>(succeededTests, failedTests);
+    priorityQueueTestCompare(succeededTests, failedTests);
+    priorityQueueTestUpdate(succeededTests, failedTests);
+    priorityQueueTestErase(succeededTests, failedTests);
+    priorityQueueTestClear(succeededTests, failedTests);
+}
+
+#endif // PRIORITYQUEUE_TESTS_HPP
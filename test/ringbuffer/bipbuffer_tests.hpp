@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BIPBUFFER_TESTS_HPP
+#define BIPBUFFER_TESTS_HPP
+
+#include "riot/ringbuffer.hpp"
+
+// Test reserve() and commit(). Expected behavior: Reservations are
+// contiguous, committed elements become readable, only one reservation can
+// be pending and a partial commit frees the rest of the reservation.
+auto bipBufferTestReserveCommit(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::BipBuffer<uint8_t, 8> bbuf;
+    uint8_t * dst = nullptr;
+    uint8_t * other = nullptr;
+    if (bbuf.reserve(0, dst) != -EINVAL || bbuf.reserve(9, dst) != -ENOMEM ||
+        bbuf.commit(1) != -EINVAL || bbuf.reserve(6, dst) != 0 || bbuf.reserve(1, other) != -EBUSY ||
+        !bbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.reserve(0, dst) != -EINVAL || ... || !bbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+    for (uint8_t i = 0; i < 4; ++i) {
+        dst[i] = i;
+    }
+    uint8_t const * src = nullptr;
+    if (bbuf.commit(7) != -EINVAL || bbuf.commit(4) != 0 || bbuf.size() != 4 || bbuf.getFree() != 4 ||
+        bbuf.block(src) != 4 || src[0] != 0 || src[3] != 3 || bbuf.reserve(4, other) != 0 ||
+        other != dst + 4 || bbuf.commit(0) != 0 || bbuf.size() != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.commit(7) != -EINVAL || bbuf.commit(4) != 0 || ... || bbuf.size() != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test region switch. Expected behavior: If the space behind the readable
+// elements is too small, the reservation is placed at the start of the
+// storage. Reading continues there after the old elements were released.
+auto bipBufferTestWrap(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::BipBuffer<int, 8> bbuf;
+    int in[] = {1, 2, 3, 4, 5, 6};
+    int * dst = nullptr;
+    int const * src = nullptr;
+    int const * begin = nullptr;
+    bbuf.block(begin);
+    bbuf.add(in, 6);
+    bbuf.release(4);
+    // Elements 5, 6 stored at index 4 and 5. Two free behind, four in front.
+    if (bbuf.contiguousFree() != 4 || bbuf.reserve(3, dst) != 0 || dst != begin ||
+        bbuf.commit(3) != 0 || bbuf.contiguousFree() != 1 || bbuf.add(in, 2) != -ENOMEM ||
+        bbuf.size() != 5 || bbuf.block(src) != 2 || src[0] != 5) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.contiguousFree() != 4 || bbuf.reserve(3, dst) != 0 || ... || src[0] != 5)\n");
+        failedTests += 1;
+        return;
+    }
+    bbuf.release(2);
+    if (bbuf.block(src) != 3 || src != dst || bbuf.contiguousFree() != 5) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.block(src) != 3 || src != dst || bbuf.contiguousFree() != 5)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test add() and get(). Expected behavior: Elements are returned in FIFO
+// order across both regions. Full BipBuffer rejects further elements.
+auto bipBufferTestAddGet(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::BipBuffer<int, 6> bbuf;
+    int in[] = {1, 2, 3, 4};
+    int out[6] = {};
+    bbuf.add(in, 4);
+    bbuf.get(out, 3);
+    bbuf.add(in, 2);
+    bbuf.add(in + 2, 1);
+    // Readable: 4 (region A), 1 2 3 (region B).
+    if (bbuf.size() != 4 || bbuf.get(out, 6) != 4 || out[0] != 4 || out[1] != 1 || out[2] != 2 ||
+        out[3] != 3 || !bbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.size() != 4 || bbuf.get(out, 6) != 4 || ... || !bbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+    if (bbuf.add(in, 4) != 0 || bbuf.add(in, 2) != 0 || !bbuf.full() || bbuf.add(in, 1) != -ENOMEM) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.add(in, 4) != 0 || bbuf.add(in, 2) != 0 || !bbuf.full() || bbuf.add(in, 1) != -ENOMEM)\n");
+        failedTests += 1;
+        return;
+    }
+    bbuf.clear();
+    if (!bbuf.empty() || bbuf.contiguousFree() != 6) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!bbuf.empty() || bbuf.contiguousFree() != 6)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all BipBuffer Tests
+auto runBipBufferTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    bipBufferTestReserveCommit(succeededTests, failedTests);
+    bipBufferTestWrap(succeededTests, failedTests);
+    bipBufferTestAddGet(succeededTests, failedTests);
+}
+
+#endif // BIPBUFFER_TESTS_HPP
@@ -9,6 +9,8 @@
 #ifndef BLOCKINGRINGBUFFER_TESTS_HPP
 #define BLOCKINGRINGBUFFER_TESTS_HPP
 
+#include "thread.h"
+#include "xtimer.h"
 #include "../testobj.hpp"
 #include "riot/ringbuffer.hpp"
 
@@ -329,6 +331,61 @@ auto blockingRingbufferTestEmpty(size_t& succeededTests, size_t& failedTests) ->
     succeededTests += 1;
 }
 
+// Test stats(): Expected behavior: Statistics of the underlying Ringbuffer
+// are forwarded.
+auto blockingRingbufferTestStats(size_t & succeededTests, size_t & failedTests) -> void
+{
+    riot::BlockingRingbuffer<int, 2, riot::Ringbuffer<int, 2, riot::RingbufferStats>> rbuf;
+    int out = 0;
+    rbuf.add(1);
+    rbuf.add(2);
+    rbuf.get(out);
+    rbuf.get(out);
+    riot::RingbufferStats stats = rbuf.stats();
+    if (stats.highWater() != 2 || stats.puts() != 2 || stats.gets() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (stats.highWater() != 2 || stats.puts() != 2 || stats.gets() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test latency(): Expected behavior: With LatencyTrace the time elements
+// spent in the ringbuffer is recorded into the latency histogram.
+auto blockingRingbufferTestLatency(size_t & succeededTests, size_t & failedTests) -> void
+{
+    riot::BlockingRingbuffer<int, 4, riot::Ringbuffer<int, 4>, riot::Mutex, riot::Semaphore,
+                             riot::LatencyTrace<4>> rbuf;
+    int out = 0;
+    rbuf.add(1);
+    rbuf.tryAdd(2);
+    xtimer_usleep(2000);
+    rbuf.get(out);
+    rbuf.tryGet(out);
+    riot::LatencyHistogram hist = rbuf.latency();
+    uint32_t slow = 0;
+    for (size_t i = 11; i < hist.buckets(); ++i) {
+        slow += hist.count(i);
+    }
+    if (hist.samples() != 2 || hist.max() < 2000 || slow != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (hist.samples() != 2 || hist.max() < 2000 || slow != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    rbuf.resetLatency();
+    if (rbuf.latency().samples() != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.latency().samples() != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
 // Test full() Method. Must return false after constructor, true after adding
 // of a single Element and false after getting a single Element.
 auto blockingRingbufferTestFull(size_t& succeededTests, size_t& failedTests) -> void
@@ -362,6 +419,222 @@ auto blockingRingbufferTestFull(size_t& succeededTests, size_t& failedTests) ->
     succeededTests += 1;
 }
 
+// Test getBatchTimed(): Expected behavior: Returns all available elements
+// up to the given maximum in FIFO order, times out on an empty ringbuffer.
+auto blockingRingbufferTestGetBatchTimed(size_t & succeededTests, size_t & failedTests) -> void
+{
+    riot::BlockingRingbuffer<int, 4> rbuf;
+    int out[4] = {};
+    rbuf.add(1);
+    rbuf.add(2);
+    rbuf.add(3);
+    if (rbuf.getBatchTimed(out, 0, 1000) != -EINVAL || rbuf.getBatchTimed(out, 2, 1000) != 2 ||
+        out[0] != 1 || out[1] != 2 || rbuf.getBatchTimed(out, 4, 1000) != 1 || out[0] != 3 ||
+        rbuf.getBatchTimed(out, 4, 1000) != -ETIMEDOUT || rbuf.getFree() != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.getBatchTimed(out, 0, 1000) != -EINVAL || ... || rbuf.getFree() != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test WakeCoalesced: Expected behavior: Added elements are withheld from
+// readers until the threshold is reached, the delay expired or flush() was
+// called. getBatchTimed() takes withheld elements on timeout.
+auto blockingRingbufferTestCoalesced(size_t & succeededTests, size_t & failedTests) -> void
+{
+    riot::BlockingRingbuffer<int, 8, riot::Ringbuffer<int, 8>, riot::Mutex, riot::Semaphore,
+                             riot::NoLatencyTrace, riot::WakeCoalesced<3, 5000>> rbuf;
+    int out[8] = {};
+    rbuf.add(1);
+    rbuf.tryAdd(2);
+    if (rbuf.tryGet(out[0]) != -EAGAIN || rbuf.empty() || rbuf.addTimed(3, 1000) != 0 ||
+        rbuf.getBatchTimed(out, 8, 1000) != 3 || out[0] != 1 || out[2] != 3) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.tryGet(out[0]) != -EAGAIN || ... || out[2] != 3)\n");
+        failedTests += 1;
+        return;
+    }
+    rbuf.add(4);
+    uint64_t start = xtimer_now_usec64();
+    if (rbuf.getTimed(out[0], 100000) != 0 || out[0] != 4 || xtimer_now_usec64() - start < 4000) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.getTimed(out[0], 100000) != 0 || out[0] != 4 || ... < 4000)\n");
+        failedTests += 1;
+        return;
+    }
+    rbuf.add(5);
+    if (rbuf.tryGet(out[0]) != -EAGAIN || rbuf.flush() != 0 || rbuf.tryGet(out[0]) != 0 || out[0] != 5) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.tryGet(out[0]) != -EAGAIN || rbuf.flush() != 0 || ... || out[0] != 5)\n");
+        failedTests += 1;
+        return;
+    }
+    rbuf.add(6);
+    if (rbuf.getBatchTimed(out, 8, 1000) != 1 || out[0] != 6) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.getBatchTimed(out, 8, 1000) != 1 || out[0] != 6)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test hand-off: Expected behavior: A reader timing out while waiting for a
+// hand-off on an empty ringbuffer withdraws its destination. Later elements
+// are stored in the ringbuffer and the destination is left untouched.
+auto blockingRingbufferTestHandOff(size_t & succeededTests, size_t & failedTests) -> void
+{
+    riot::BlockingRingbuffer<int, 4> rbuf;
+    int out = 0;
+    if (rbuf.getTimed(out, 1000) != -ETIMEDOUT || rbuf.add(1) != 0 || rbuf.tryAdd(2) != 0 ||
+        out != 0 || rbuf.getFree() != 2 || rbuf.get(out) != 0 || out != 1 ||
+        rbuf.getTimed(out, 1000) != 0 || out != 2 || !rbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.getTimed(out, 1000) != -ETIMEDOUT || rbuf.add(1) != 0 || ... || !rbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Elements added by blockingRingbufferTestFeeder.
+template <typename Queue>
+class BlockingRingbufferTestFeed
+{
+public:
+    Queue * queue;
+    int first;
+    int count;
+    uint32_t delay;
+};
+
+static char blockingRingbufferTestStack[THREAD_STACKSIZE_DEFAULT];
+
+// Runs with lower priority than the test. Adds count elements starting at
+// first, sleeps delay usec before each and cycles add(), tryAdd(), addTimed().
+template <typename Queue>
+auto blockingRingbufferTestFeeder(void * arg) -> void *
+{
+    BlockingRingbufferTestFeed<Queue> * feed = static_cast<BlockingRingbufferTestFeed<Queue> *>(arg);
+    for (int i = 0; i < feed->count; ++i) {
+        xtimer_usleep(feed->delay);
+        int value = feed->first + i;
+        if (i % 3 == 0) {
+            feed->queue->add(value);
+        } else if (i % 3 == 1) {
+            while (feed->queue->tryAdd(value) != 0) {
+                xtimer_usleep(100);
+            }
+        } else {
+            feed->queue->addTimed(value, 1000000);
+        }
+    }
+    return nullptr;
+}
+
+template <typename Queue>
+auto blockingRingbufferTestStartFeeder(BlockingRingbufferTestFeed<Queue> & feed) -> kernel_pid_t
+{
+    return thread_create(blockingRingbufferTestStack, sizeof(blockingRingbufferTestStack),
+                         THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                         blockingRingbufferTestFeeder<Queue>, &feed, "feeder");
+}
+
+inline auto blockingRingbufferTestJoin(kernel_pid_t pid) -> void
+{
+    while (thread_getstatus(pid) != STATUS_NOT_FOUND) {
+        xtimer_usleep(100);
+    }
+}
+
+// Test hand-off with a writer thread: Expected behavior: get() and getTimed()
+// first return the stored elements, then block and receive the elements
+// added by add(), tryAdd() and addTimed() of the writer in FIFO order.
+auto blockingRingbufferTestHandOffThreaded(size_t & succeededTests, size_t & failedTests) -> void
+{
+    typedef riot::BlockingRingbuffer<int, 4> Queue;
+    Queue rbuf;
+    rbuf.add(1);
+    rbuf.add(2);
+    BlockingRingbufferTestFeed<Queue> feed = {&rbuf, 3, 6, 1000};
+    kernel_pid_t pid = blockingRingbufferTestStartFeeder(feed);
+    int out[8] = {};
+    int errs = 0;
+    for (int i = 0; i < 8; ++i) {
+        errs += (i % 2) ? rbuf.getTimed(out[i], 1000000) : rbuf.get(out[i]);
+    }
+    blockingRingbufferTestJoin(pid);
+    bool fifo = true;
+    for (int i = 0; i < 8; ++i) {
+        fifo = fifo && (out[i] == i + 1);
+    }
+    if (errs != 0 || !fifo || !rbuf.empty() || rbuf.getFree() != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (errs != 0 || !fifo || !rbuf.empty() || rbuf.getFree() != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test WakeCoalesced with a writer thread: Expected behavior: A reader blocked
+// in getBatchTimed() is not woken before the threshold is reached, it gets the
+// whole batch at once instead of the elements one by one.
+auto blockingRingbufferTestCoalescedThreaded(size_t & succeededTests, size_t & failedTests) -> void
+{
+    typedef riot::BlockingRingbuffer<int, 8, riot::Ringbuffer<int, 8>, riot::Mutex, riot::Semaphore,
+                                     riot::NoLatencyTrace, riot::WakeCoalesced<4, 200000>> Queue;
+    Queue rbuf;
+    BlockingRingbufferTestFeed<Queue> feed = {&rbuf, 1, 4, 5000};
+    int out[4] = {};
+    uint64_t start = xtimer_now_usec64();
+    kernel_pid_t pid = blockingRingbufferTestStartFeeder(feed);
+    int taken = rbuf.getBatchTimed(out, 4, 150000);
+    uint64_t elapsed = xtimer_now_usec64() - start;
+    blockingRingbufferTestJoin(pid);
+    if (taken != 4 || elapsed < 20000 || elapsed >= 150000 || out[0] != 1 || out[3] != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (taken != 4 || elapsed < 20000 || elapsed >= 150000 || out[0] != 1 || out[3] != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test statistics and latency trace with a writer thread: Expected behavior:
+// Elements added while the reader is blocked on the empty ringbuffer are
+// counted and traced.
+auto blockingRingbufferTestStatsThreaded(size_t & succeededTests, size_t & failedTests) -> void
+{
+    typedef riot::BlockingRingbuffer<int, 2, riot::Ringbuffer<int, 2, riot::RingbufferStats>,
+                                     riot::Mutex, riot::Semaphore, riot::LatencyTrace<2>> Queue;
+    Queue rbuf;
+    BlockingRingbufferTestFeed<Queue> feed = {&rbuf, 1, 3, 1000};
+    kernel_pid_t pid = blockingRingbufferTestStartFeeder(feed);
+    int out = 0;
+    int errs = 0;
+    for (int i = 0; i < 3; ++i) {
+        errs += rbuf.get(out);
+    }
+    blockingRingbufferTestJoin(pid);
+    riot::RingbufferStats stats = rbuf.stats();
+    if (errs != 0 || out != 3 || stats.puts() != 3 || stats.gets() != 3 || rbuf.latency().samples() != 3) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (errs != 0 || out != 3 || ... || rbuf.latency().samples() != 3)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
 auto runBlockingRingbufferTests(size_t & succeededTests, size_t & failedTests) -> void
 {
     blockingRingbufferTestDefaultConstructor(succeededTests, failedTests);
@@ -376,6 +649,14 @@ auto runBlockingRingbufferTests(size_t & succeededTests, size_t & failedTests) -
     blockingRingbufferTestGetFree(succeededTests, failedTests);
     blockingRingbufferTestEmpty(succeededTests, failedTests);
     blockingRingbufferTestFull(succeededTests, failedTests);
+    blockingRingbufferTestStats(succeededTests, failedTests);
+    blockingRingbufferTestLatency(succeededTests, failedTests);
+    blockingRingbufferTestGetBatchTimed(succeededTests, failedTests);
+    blockingRingbufferTestCoalesced(succeededTests, failedTests);
+    blockingRingbufferTestHandOff(succeededTests, failedTests);
+    blockingRingbufferTestHandOffThreaded(succeededTests, failedTests);
+    blockingRingbufferTestCoalescedThreaded(succeededTests, failedTests);
+    blockingRingbufferTestStatsThreaded(succeededTests, failedTests);
 }
 
 #endif // BLOCKINGRINGBUFFER_TESTS_HPP
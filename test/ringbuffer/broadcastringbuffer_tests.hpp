@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef BROADCASTRINGBUFFER_TESTS_HPP
+#define BROADCASTRINGBUFFER_TESTS_HPP
+
+#include "thread.h"
+#include "xtimer.h"
+#include "riot/ringbuffer.hpp"
+
+// Test attach() and detach(). Expected behavior: Up to Readers ids are
+// handed out, detached ids are reused, invalid ids are rejected.
+auto broadcastRingbufferTestAttach(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::BroadcastRingbuffer<int, 4, 2> bbuf;
+    int out = 0;
+    int a = bbuf.attach();
+    int b = bbuf.attach();
+    if (a != 0 || b != 1 || bbuf.attach() != -ENOMEM || bbuf.detach(a) != 0 || bbuf.detach(a) != -EINVAL ||
+        bbuf.tryGet(a, out) != -EINVAL || bbuf.tryGet(7, out) != -EINVAL || bbuf.available(-1) != -EINVAL ||
+        bbuf.attach() != a) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (a != 0 || b != 1 || bbuf.attach() != -ENOMEM || ... || bbuf.attach() != a)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test fan-out with BroadcastWaitForSlowest. Expected behavior: Every reader
+// gets every element in order. The slowest reader holds back the writer until
+// it reads or detaches.
+auto broadcastRingbufferTestWaitForSlowest(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::BroadcastRingbuffer<int, 3, 3> bbuf;
+    int fast = bbuf.attach();
+    int slow = bbuf.attach();
+    int out = 0;
+    for (int i = 1; i <= 3; ++i) {
+        bbuf.add(i);
+        bbuf.get(fast, out);
+    }
+    if (out != 3 || bbuf.available(fast) != 0 || bbuf.available(slow) != 3 || bbuf.getFree() != 0 ||
+        bbuf.tryAdd(4) != -EAGAIN || bbuf.addTimed(4, 1000) != -ETIMEDOUT ||
+        bbuf.getTimed(fast, out, 1000) != -ETIMEDOUT) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (out != 3 || bbuf.available(fast) != 0 || ... || bbuf.getTimed(fast, out, 1000) != -ETIMEDOUT)\n");
+        failedTests += 1;
+        return;
+    }
+    if (bbuf.tryGet(slow, out) != 0 || out != 1 || bbuf.tryAdd(4) != 0 || bbuf.get(slow, out) != 0 ||
+        out != 2 || bbuf.getTimed(fast, out, 1000) != 0 || out != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.tryGet(slow, out) != 0 || out != 1 || ... || out != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    bbuf.detach(slow);
+    if (bbuf.tryAdd(5) != 0 || bbuf.tryAdd(6) != 0 || bbuf.tryAdd(7) != 0 || bbuf.tryAdd(8) != -EAGAIN) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.tryAdd(5) != 0 || ... || bbuf.tryAdd(8) != -EAGAIN)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test BroadcastOverwriteSlowest. Expected behavior: Writer never waits,
+// a lagging reader loses its oldest elements and gets the newest Size ones.
+auto broadcastRingbufferTestOverwriteSlowest(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::BroadcastRingbuffer<int, 3, 2, riot::BroadcastOverwriteSlowest> bbuf;
+    int fast = bbuf.attach();
+    int slow = bbuf.attach();
+    int out = 0;
+    for (int i = 1; i <= 5; ++i) {
+        if (bbuf.tryAdd(i) != 0 || bbuf.tryGet(fast, out) != 0 || out != i) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (bbuf.tryAdd(i) != 0 || bbuf.tryGet(fast, out) != 0 || out != i)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    if (bbuf.lost(fast) != 0 || bbuf.lost(slow) != 2 || bbuf.available(slow) != 3 ||
+        bbuf.get(slow, out) != 0 || out != 3 || bbuf.get(slow, out) != 0 || out != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (bbuf.lost(fast) != 0 || bbuf.lost(slow) != 2 || ... || out != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+typedef riot::BroadcastRingbuffer<int, 4, 2> BroadcastRingbufferTestQueue;
+
+// Reader detached by broadcastRingbufferTestDetacher.
+class BroadcastRingbufferTestDetach
+{
+public:
+    BroadcastRingbufferTestQueue * queue;
+    int id;
+};
+
+static char broadcastRingbufferTestStack[THREAD_STACKSIZE_DEFAULT];
+
+// Runs with lower priority than the reader. Detaches the reader while it is
+// blocked in get().
+auto broadcastRingbufferTestDetacher(void * arg) -> void *
+{
+    BroadcastRingbufferTestDetach * detach = static_cast<BroadcastRingbufferTestDetach *>(arg);
+    xtimer_usleep(1000);
+    detach->queue->detach(detach->id);
+    return nullptr;
+}
+
+// Test detach() with a blocked reader. Expected behavior: get() of the
+// detached reader wakes up and returns -EINVAL.
+auto broadcastRingbufferTestDetachBlocked(size_t& succeededTests, size_t& failedTests) -> void
+{
+    BroadcastRingbufferTestQueue bbuf;
+    int out = 0;
+    BroadcastRingbufferTestDetach detach = {&bbuf, bbuf.attach()};
+    kernel_pid_t pid = thread_create(broadcastRingbufferTestStack, sizeof(broadcastRingbufferTestStack),
+                                     THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                                     broadcastRingbufferTestDetacher, &detach, "detacher");
+    int err = bbuf.get(detach.id, out);
+    while (thread_getstatus(pid) != STATUS_NOT_FOUND) {
+        xtimer_usleep(100);
+    }
+    if (err != -EINVAL || bbuf.available(detach.id) != -EINVAL || bbuf.attach() != detach.id) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (err != -EINVAL || bbuf.available(detach.id) != -EINVAL || bbuf.attach() != detach.id)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all BroadcastRingbuffer Tests
+auto runBroadcastRingbufferTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    broadcastRingbufferTestAttach(succeededTests, failedTests);
+    broadcastRingbufferTestWaitForSlowest(succeededTests, failedTests);
+    broadcastRingbufferTestOverwriteSlowest(succeededTests, failedTests);
+    broadcastRingbufferTestDetachBlocked(succeededTests, failedTests);
+}
+
+#endif // BROADCASTRINGBUFFER_TESTS_HPP
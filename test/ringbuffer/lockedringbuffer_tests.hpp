@@ -505,6 +505,46 @@ auto lockedRingbufferTestSwap(size_t& succeededTests, size_t& failedTests) -> vo
     succeededTests += 1;
 }
 
+// Test stats(): Expected behavior: Statistics of the underlying Ringbuffer
+// are forwarded.
+auto lockedRingbufferTestStats(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::LockedRingbuffer<int, 2, riot::Ringbuffer<int, 2, riot::RingbufferStats>> rbuf;
+    int out = 0;
+    rbuf.putOne(1);
+    rbuf.putOne(2);
+    rbuf.putOne(3);
+    rbuf.getOne(out);
+    riot::RingbufferStats stats = rbuf.stats();
+    if (stats.highWater() != 2 || stats.rejected() != 1 || stats.puts() != 2 || stats.gets() != 1) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (stats.highWater() != 2 || stats.rejected() != 1 || stats.puts() != 2 || stats.gets() != 1)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test byte stream interface: Expected behavior: write(), read(),
+// readUntil() and skip() of the underlying Ringbuffer are forwarded.
+auto lockedRingbufferTestByteStream(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::LockedRingbuffer<uint8_t, 6> rbuf;
+    uint8_t in[] = {1, 2, 0, 3, 4, 5, 6};
+    uint8_t out[6] = {};
+    if (rbuf.write(in, sizeof(in)) != 6 || rbuf.readUntil(out, sizeof(out), 0) != 3 ||
+        out[0] != 1 || out[2] != 0 || rbuf.skip(1) != 1 || rbuf.read(out, sizeof(out)) != 2 ||
+        out[0] != 4 || out[1] != 5 || !rbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.write(in, sizeof(in)) != 6 || rbuf.readUntil(out, sizeof(out), 0) != 3 || ... || !rbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
 // Run all Ringbuffer Tests
 auto runLockedRingbufferTests(size_t& succeededTests, size_t& failedTests) -> void
 {
@@ -526,6 +566,8 @@ auto runLockedRingbufferTests(size_t& succeededTests, size_t& failedTests) -> vo
     lockedRingbufferTestFull(succeededTests, failedTests);
     lockedRingbufferTestRemove(succeededTests, failedTests);
     lockedRingbufferTestSwap(succeededTests, failedTests);
+    lockedRingbufferTestStats(succeededTests, failedTests);
+    lockedRingbufferTestByteStream(succeededTests, failedTests);
 }
 
 #endif // LOCKEDRINGBUFFER_TESTS_HPP
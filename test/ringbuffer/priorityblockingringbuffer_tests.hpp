@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef PRIORITYBLOCKINGRINGBUFFER_TESTS_HPP
+#define PRIORITYBLOCKINGRINGBUFFER_TESTS_HPP
+
+#include "riot/ringbuffer.hpp"
+
+// Test get() order. Expected Behavior: Elements of the highest non-empty level
+// (lowest index) are returned first, FIFO within a level.
+auto priorityBlockingRingbufferTestOrder(size_t & succeededTests, size_t & failedTests) -> void
+{
+    riot::PriorityBlockingRingbuffer<int, 3, 4> pbuf;
+    pbuf.add(2, 20);
+    pbuf.add(2, 21);
+    pbuf.add(1, 10);
+    pbuf.add(0, 0);
+    pbuf.add(1, 11);
+    int expected[] = {0, 10, 11, 20, 21};
+    size_t levels[] = {0, 1, 1, 2, 2};
+    int out = 0;
+    size_t level = 0;
+    for (size_t i = 0; i < 5; ++i) {
+        if (pbuf.get(out, level) != 0 || out != expected[i] || level != levels[i]) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (pbuf.get(out, level) != 0 || out != expected[i] || level != levels[i])\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    if (!pbuf.empty() || pbuf.tryGet(out) != -EAGAIN || pbuf.getTimed(out, 1000) != -ETIMEDOUT) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!pbuf.empty() || pbuf.tryGet(out) != -EAGAIN || pbuf.getTimed(out, 1000) != -ETIMEDOUT)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test per level capacity. Expected Behavior: A full level rejects further
+// elements with -EAGAIN or -ETIMEDOUT, other levels accept elements.
+// Invalid levels are rejected with -EINVAL.
+auto priorityBlockingRingbufferTestLevels(size_t & succeededTests, size_t & failedTests) -> void
+{
+    riot::PriorityBlockingRingbuffer<int, 2, 2> pbuf;
+    int out = 0;
+    pbuf.add(1, 1);
+    pbuf.add(1, 2);
+    if (!pbuf.full(1) || pbuf.tryAdd(1, 3) != -EAGAIN || pbuf.addTimed(1, 3, 1000) != -ETIMEDOUT ||
+        pbuf.tryAdd(0, 4) != 0 || pbuf.addTimed(0, 5, 1000) != 0 || pbuf.getFree(0) != 0 ||
+        pbuf.add(2, 6) != -EINVAL || pbuf.tryAdd(2, 6) != -EINVAL || pbuf.full(2) == 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!pbuf.full(1) || pbuf.tryAdd(1, 3) != -EAGAIN || ... || pbuf.full(2) == 0)\n");
+        failedTests += 1;
+        return;
+    }
+    if (pbuf.get(out) != 0 || out != 4 || pbuf.getFree(0) != 1 || pbuf.getFree(1) != 0 ||
+        pbuf.get(out) != 0 || out != 5 || pbuf.tryGet(out) != 0 || out != 1 || pbuf.tryAdd(1, 3) != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (pbuf.get(out) != 0 || out != 4 || ... || pbuf.tryAdd(1, 3) != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all PriorityBlockingRingbuffer Tests
+auto runPriorityBlockingRingbufferTests(size_t & succeededTests, size_t & failedTests) -> void
+{
+    priorityBlockingRingbufferTestOrder(succeededTests, failedTests);
+    priorityBlockingRingbufferTestLevels(succeededTests, failedTests);
+}
+
+#endif // PRIORITYBLOCKINGRINGBUFFER_TESTS_HPP
@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef RECORDRINGBUFFER_TESTS_HPP
+#define RECORDRINGBUFFER_TESTS_HPP
+
+#include <cstring>
+#include "riot/ringbuffer.hpp"
+
+// Test putRecord() and getRecord(). Expected behavior: Records of different
+// length are returned in FIFO order. Records exceeding the free space are
+// rejected with -ENOMEM, records exceeding maxRecordSize() with -EINVAL.
+auto recordRingbufferTestPutGet(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::RecordRingbuffer<16> rbuf;
+    char out[16] = {};
+    if (rbuf.maxRecordSize() != 15 || rbuf.putRecord("abc", 3) != 0 ||
+        rbuf.putRecord("defghij", 7) != 0 || rbuf.putRecord("xyzxyz", 6) != -ENOMEM ||
+        rbuf.putRecord(out, 16) != -EINVAL || rbuf.records() != 2 || rbuf.getFree() != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.maxRecordSize() != 15 || ... || rbuf.records() != 2 || rbuf.getFree() != 4)\n");
+        failedTests += 1;
+        return;
+    }
+    if (rbuf.peekRecordSize() != 3 || rbuf.getRecord(out, 2) != -ENOBUFS ||
+        rbuf.getRecord(out, sizeof(out)) != 3 || memcmp(out, "abc", 3) != 0 ||
+        rbuf.getRecord(out, sizeof(out)) != 7 || memcmp(out, "defghij", 7) != 0 ||
+        rbuf.getRecord(out, sizeof(out)) != -EAGAIN || rbuf.peekRecordSize() != -EAGAIN ||
+        !rbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.peekRecordSize() != 3 || rbuf.getRecord(out, 2) != -ENOBUFS || ... || !rbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+    // Zero length records are records as well.
+    if (rbuf.putRecord(nullptr, 0) != 0 || rbuf.records() != 1 || rbuf.getRecord(out, 0) != 0 ||
+        !rbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.putRecord(nullptr, 0) != 0 || ... || !rbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test wrap around. Expected behavior: Records wrapping around the end of the
+// storage are copied by getRecord(), frontRecord() refuses them with -ERANGE
+// and hands out contiguous records without copy.
+auto recordRingbufferTestWrap(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::RecordRingbuffer<16> rbuf;
+    char out[16] = {};
+    void const * data = nullptr;
+
+    // Bytes 0-7 used, then free first 8 bytes so the next record wraps.
+    rbuf.putRecord("0123456", 7);
+    rbuf.putRecord("ab", 2);
+    rbuf.popRecord();
+    if (rbuf.putRecord("ABCDEFGHI", 9) != 0 || rbuf.frontRecord(data) != 2 ||
+        memcmp(data, "ab", 2) != 0 || rbuf.popRecord() != 2 ||
+        rbuf.frontRecord(data) != -ERANGE || rbuf.peekRecord(out, sizeof(out)) != 9 ||
+        memcmp(out, "ABCDEFGHI", 9) != 0 || rbuf.getRecord(out, sizeof(out)) != 9) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.putRecord(\"ABCDEFGHI\", 9) != 0 || ... || rbuf.getRecord(out, sizeof(out)) != 9)\n");
+        failedTests += 1;
+        return;
+    }
+    // Empty ringbuffer restarts at the beginning: A maximum sized record is contiguous.
+    if (rbuf.putRecord("0123456789abcde", 15) != 0 || rbuf.frontRecord(data) != 15 ||
+        memcmp(data, "0123456789abcde", 15) != 0 || rbuf.frontRecord(data) != 15 ||
+        rbuf.popRecord() != 15 || rbuf.frontRecord(data) != -EAGAIN || rbuf.popRecord() != -EAGAIN) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.putRecord(\"0123456789abcde\", 15) != 0 || ... || rbuf.popRecord() != -EAGAIN)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test length prefix. Expected behavior: Prefix uses the IndexType of the
+// storage size, records longer than 255 bytes are supported.
+auto recordRingbufferTestLongRecord(size_t& succeededTests, size_t& failedTests) -> void
+{
+    static riot::RecordRingbuffer<1024> rbuf;
+    static uint8_t in[300];
+    static uint8_t out[300];
+    for (size_t i = 0; i < sizeof(in); ++i) {
+        in[i] = static_cast<uint8_t>(i);
+    }
+    if (sizeof(riot::RecordRingbuffer<1024>::IndexType) != 2 ||
+        sizeof(riot::RecordRingbuffer<200>) != 203) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sizeof(riot::RecordRingbuffer<1024>::IndexType) != 2 || sizeof(riot::RecordRingbuffer<200>) != 203)\n");
+        failedTests += 1;
+        return;
+    }
+    // Move through the storage so that records wrap at different positions.
+    for (size_t i = 0; i < 20; ++i) {
+        rbuf.putRecord(in, 4);
+        if (rbuf.putRecord(in, 300) != 0 || rbuf.popRecord() != 4 || rbuf.peekRecordSize() != 300 ||
+            rbuf.getRecord(out, sizeof(out)) != 300 || memcmp(in, out, sizeof(in)) != 0) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (rbuf.putRecord(in, 300) != 0 || ... || memcmp(in, out, sizeof(in)) != 0)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test statistics policy. Expected behavior: Records are counted, not bytes.
+auto recordRingbufferTestStats(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::RecordRingbuffer<8, riot::RingbufferStats> rbuf;
+    char out[8];
+    rbuf.putRecord("ab", 2);
+    rbuf.putRecord("cd", 2);
+    rbuf.putRecord("ef", 2);   // rejected
+    rbuf.getRecord(out, sizeof(out));
+    riot::RingbufferStats const & stats = rbuf.stats();
+    if (stats.highWater() != 2 || stats.puts() != 2 || stats.rejected() != 1 || stats.gets() != 1) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (stats.highWater() != 2 || stats.puts() != 2 || stats.rejected() != 1 || stats.gets() != 1)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test LockedRecordRingbuffer. Expected behavior: Operations of the
+// underlying RecordRingbuffer are forwarded.
+auto lockedRecordRingbufferTestForward(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::LockedRecordRingbuffer<32> rbuf;
+    char out[32] = {};
+    void const * data = nullptr;
+    if (rbuf.putRecord("hello", 5) != 0 || rbuf.putRecord("world!", 6) != 0 || rbuf.records() != 2 ||
+        rbuf.fits(19) || !rbuf.fits(18) || rbuf.frontRecord(data) != 5 || memcmp(data, "hello", 5) != 0 ||
+        rbuf.popRecord() != 5 || rbuf.peekRecordSize() != 6 || rbuf.getRecord(out, sizeof(out)) != 6 ||
+        memcmp(out, "world!", 6) != 0 || !rbuf.empty() || rbuf.getFree() != 32) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.putRecord(\"hello\", 5) != 0 || ... || !rbuf.empty() || rbuf.getFree() != 32)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test BlockingRecordRingbuffer non-blocking and timed operations. Expected
+// behavior: Full ringbuffer returns -EAGAIN or -ETIMEDOUT on put, empty
+// ringbuffer on get. Too small buffers keep the record.
+auto blockingRecordRingbufferTestPutGet(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::BlockingRecordRingbuffer<12> rbuf;
+    char out[12] = {};
+    if (rbuf.tryGetRecord(out, sizeof(out)) != -EAGAIN || rbuf.getRecordTimed(out, sizeof(out), 1000) != -ETIMEDOUT ||
+        rbuf.putRecord("abcd", 4) != 0 || rbuf.tryPutRecord("efgh", 4) != 0 ||
+        rbuf.tryPutRecord("ij", 2) != -EAGAIN || rbuf.putRecordTimed("ij", 2, 1000) != -ETIMEDOUT ||
+        rbuf.putRecord(out, 12) != -EINVAL) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.tryGetRecord(out, sizeof(out)) != -EAGAIN || ... || rbuf.putRecord(out, 12) != -EINVAL)\n");
+        failedTests += 1;
+        return;
+    }
+    if (rbuf.getRecord(out, 2) != -ENOBUFS || rbuf.records() != 2 || rbuf.getRecord(out, sizeof(out)) != 4 ||
+        memcmp(out, "abcd", 4) != 0 || rbuf.putRecordTimed("ij", 2, 1000) != 0 ||
+        rbuf.getRecordTimed(out, sizeof(out), 1000) != 4 || memcmp(out, "efgh", 4) != 0 ||
+        rbuf.tryGetRecord(out, sizeof(out)) != 2 || memcmp(out, "ij", 2) != 0 || !rbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.getRecord(out, 2) != -ENOBUFS || ... || !rbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all RecordRingbuffer Tests
+auto runRecordRingbufferTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    recordRingbufferTestPutGet(succeededTests, failedTests);
+    recordRingbufferTestWrap(succeededTests, failedTests);
+    recordRingbufferTestLongRecord(succeededTests, failedTests);
+    recordRingbufferTestStats(succeededTests, failedTests);
+    lockedRecordRingbufferTestForward(succeededTests, failedTests);
+    blockingRecordRingbufferTestPutGet(succeededTests, failedTests);
+}
+
+#endif // RECORDRINGBUFFER_TESTS_HPP
@@ -528,6 +528,137 @@ auto ringbufferTestSwap(size_t& succeededTests, size_t& failedTests) -> void
     succeededTests += 1;
 }
 
+// Test IndexType: Expected behavior: Smallest unsigned type holding Size is
+// used, a Ringbuffer adds only two indices to its element storage.
+auto ringbufferTestIndexType(size_t& succeededTests, size_t& failedTests) -> void
+{
+    if (sizeof(riot::Ringbuffer<uint8_t, 255>::IndexType) != 1 ||
+        sizeof(riot::Ringbuffer<uint8_t, 256>::IndexType) != 2 ||
+        sizeof(riot::Ringbuffer<uint8_t, 65536>::IndexType) != 4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sizeof(IndexType) != 1 (Size 255) || != 2 (Size 256) || != 4 (Size 65536))\n");
+        failedTests += 1;
+        return;
+    }
+    if (sizeof(riot::Ringbuffer<uint8_t, 16>) != 18) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sizeof(riot::Ringbuffer<uint8_t, 16>) != 18)\n");
+        failedTests += 1;
+        return;
+    }
+
+    // Wrap around with a full 8-bit index range.
+    riot::Ringbuffer<uint8_t, 255> rbuf;
+    uint8_t out = 0;
+    for (size_t i = 0; i < 600; ++i) {
+        rbuf.addOne(static_cast<uint8_t>(i));
+    }
+    if (!rbuf.full() || rbuf.getOne(out) != 0 || out != static_cast<uint8_t>(600 - 255)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!rbuf.full() || rbuf.getOne(out) != 0 || out != static_cast<uint8_t>(600 - 255))\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test statistics policy: Expected behavior: RingbufferStats records
+// high-water mark, rejections, overwrites, puts and gets, remove() counts as
+// gets. RingbufferNoStats adds no memory.
+auto ringbufferTestStats(size_t& succeededTests, size_t& failedTests) -> void
+{
+    if (sizeof(riot::Ringbuffer<uint8_t, 16, riot::RingbufferNoStats>) != sizeof(riot::Ringbuffer<uint8_t, 16>) ||
+        sizeof(riot::Ringbuffer<uint8_t, 16>) != 18) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sizeof(riot::Ringbuffer<uint8_t, 16, riot::RingbufferNoStats>) != 18)\n");
+        failedTests += 1;
+        return;
+    }
+
+    riot::Ringbuffer<int, 3, riot::RingbufferStats> rbuf;
+    int values[] = {1, 2, 3, 4};
+    int out[4];
+    rbuf.putOne(0);
+    rbuf.getOne(out[0]);
+    rbuf.add(values, 4);   // 3 stored, 1 rejected
+    rbuf.putOne(5);        // rejected
+    rbuf.addOne(6);        // overwrites 1
+    rbuf.get(out, 2);
+    riot::RingbufferStats const & stats = rbuf.stats();
+    if (stats.highWater() != 3 || stats.rejected() != 2 || stats.overwritten() != 1 ||
+        stats.puts() != 5 || stats.gets() != 3) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (stats.highWater() != 3 || stats.rejected() != 2 || stats.overwritten() != 1 || stats.puts() != 5 || stats.gets() != 3)\n");
+        failedTests += 1;
+        return;
+    }
+    rbuf.resetStats();
+    if (stats.highWater() != 0 || stats.puts() != 0 || rbuf.getFree() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (stats.highWater() != 0 || stats.puts() != 0 || rbuf.getFree() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    rbuf.putOne(7);
+    if (rbuf.remove(4) != 2 || stats.puts() != 1 || stats.gets() != 2) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.remove(4) != 2 || stats.puts() != 1 || stats.gets() != 2)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test byte stream interface: Expected behavior: write() and read() transfer
+// chunks across the end of the storage, readUntil() returns complete lines
+// only, skip() discards bytes.
+auto ringbufferTestByteStream(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Ringbuffer<char, 8> rbuf;
+    char out[8] = {};
+
+    // Move start index to the middle of the storage, then write across the end.
+    if (rbuf.write("abcde", 5) != 5 || rbuf.skip(5) != 5 || rbuf.write("0123456789", 10) != 8 ||
+        rbuf.read(out, 3) != 3 || memcmp(out, "012", 3) != 0 || rbuf.read(out, 8) != 5 ||
+        memcmp(out, "34567", 5) != 0 || !rbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.write(\"abcde\", 5) != 5 || ... || !rbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+
+    rbuf.write("ab\ncd", 5);
+    if (rbuf.readUntil(out, sizeof(out), '\n') != 3 || memcmp(out, "ab\n", 3) != 0 ||
+        rbuf.readUntil(out, sizeof(out), '\n') != -EAGAIN || rbuf.getFree() != 6) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.readUntil(out, sizeof(out), '\\n') != 3 || ... != -EAGAIN || rbuf.getFree() != 6)\n");
+        failedTests += 1;
+        return;
+    }
+
+    rbuf.write("efg\n", 4);
+    if (rbuf.readUntil(out, 4, '\n') != -ENOBUFS || rbuf.readUntil(out, 6, '\n') != 6 ||
+        memcmp(out, "cdefg\n", 6) != 0 || !rbuf.empty()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.readUntil(out, 4, '\\n') != -ENOBUFS || rbuf.readUntil(out, 6, '\\n') != 6 || ... || !rbuf.empty())\n");
+        failedTests += 1;
+        return;
+    }
+
+    // Full buffer without delimiter can never complete a line.
+    rbuf.write("xxxxxxxx", 8);
+    if (rbuf.readUntil(out, sizeof(out), '\n') != -ENOBUFS) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rbuf.readUntil(out, sizeof(out), '\\n') != -ENOBUFS)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
 // Run all Ringbuffer Tests
 auto runRingbufferTests(size_t& succeededTests, size_t& failedTests) -> void
 {
@@ -549,6 +680,9 @@ auto runRingbufferTests(size_t& succeededTests, size_t& failedTests) -> void
     ringbufferTestFull(succeededTests, failedTests);
     ringbufferTestRemove(succeededTests, failedTests);
     ringbufferTestSwap(succeededTests, failedTests);
+    ringbufferTestIndexType(succeededTests, failedTests);
+    ringbufferTestStats(succeededTests, failedTests);
+    ringbufferTestByteStream(succeededTests, failedTests);
 }
 
 #endif // RINGBUFFER_TESTS_HPP
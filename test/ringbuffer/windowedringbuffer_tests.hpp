@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef WINDOWEDRINGBUFFER_TESTS_HPP
+#define WINDOWEDRINGBUFFER_TESTS_HPP
+
+#include "riot/ringbuffer.hpp"
+
+// Test sum, mean and variance. Expected behavior: Aggregates cover only the
+// last N values. Values leaving the window are subtracted.
+auto windowedRingbufferTestSum(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::WindowedRingbuffer<int16_t, 4, riot::WindowSum, riot::WindowVariance> win;
+    if (!win.empty() || win.sum() != 0 || win.mean() != 0 || win.variance() != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!win.empty() || win.sum() != 0 || win.mean() != 0 || win.variance() != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    int16_t in[] = {2, 4, 4, 4, 5, 5, 7, 9};
+    win.add(in, 4);
+    if (!win.full() || win.size() != 4 || win.sum() != 14 || win.mean() != 3 || win.variance() != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!win.full() || win.size() != 4 || win.sum() != 14 || ... || win.variance() != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    // Window holds 5, 5, 7, 9: mean 6.5, variance 2.75
+    win.add(in + 4, 4);
+    int16_t out[4] = {};
+    if (win.size() != 4 || win.sum() != 26 || win.mean() != 6 || win.variance() != 2 ||
+        win.peek(out, 4) != 4 || out[0] != 5 || out[3] != 9) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (win.size() != 4 || win.sum() != 26 || ... || out[3] != 9)\n");
+        failedTests += 1;
+        return;
+    }
+    riot::WindowedRingbuffer<float, 8, riot::WindowSum, riot::WindowVariance> fwin;
+    for (uint8_t i = 0; i < 8; ++i) {
+        fwin.add(in[i]);
+    }
+    if (fwin.mean() != 5.0 || fwin.variance() != 4.0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (fwin.mean() != 5.0 || fwin.variance() != 4.0)\n");
+        failedTests += 1;
+        return;
+    }
+    win.clear();
+    if (!win.empty() || win.sum() != 0 || win.variance() != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!win.empty() || win.sum() != 0 || win.variance() != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test min and max. Expected behavior: Match a brute force scan of the window
+// after every add, for rising, falling and repeated values.
+auto windowedRingbufferTestMinMax(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::WindowedRingbuffer<int32_t, 5, riot::WindowMin, riot::WindowMax> win;
+    int32_t in[] = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9,
+                    10, 11, 12, 13, 14, 15, 14, 13, 12, 11, 10, 7, 7, 7, 7, 7, 7};
+    for (uint8_t i = 0; i < sizeof(in) / sizeof(in[0]); ++i) {
+        win.add(in[i]);
+        int32_t window[5] = {};
+        size_t n = win.peek(window, 5);
+        int32_t min = window[0];
+        int32_t max = window[0];
+        for (size_t j = 1; j < n; ++j) {
+            min = (window[j] < min) ? window[j] : min;
+            max = (window[j] > max) ? window[j] : max;
+        }
+        if (win.min() != min || win.max() != max) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (win.min() != min || win.max() != max)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    win.clear();
+    win.add(-4);
+    if (win.size() != 1 || win.min() != -4 || win.max() != -4) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (win.size() != 1 || win.min() != -4 || win.max() != -4)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all WindowedRingbuffer Tests
+auto runWindowedRingbufferTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    windowedRingbufferTestSum(succeededTests, failedTests);
+    windowedRingbufferTestMinMax(succeededTests, failedTests);
+}
+
+#endif // WINDOWEDRINGBUFFER_TESTS_HPP
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef SELECTOR_TESTS_HPP
+#define SELECTOR_TESTS_HPP
+
+#include "thread.h"
+#include "xtimer.h"
+#include "riot/ringbuffer.hpp"
+#include "riot/selector.hpp"
+
+typedef riot::BlockingRingbuffer<int, 4, riot::Ringbuffer<int, 4>, riot::Mutex,
+                                 riot::WatchableSemaphore> SelectorTestQueue;
+
+// Test add() and the wait operations. Expected behavior: Sources are
+// registered up to the capacity, the ready source is returned with its
+// operation completed and waitTimed() times out if nothing is ready.
+auto selectorTestWait(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Selector<3> sel;
+    SelectorTestQueue first;
+    SelectorTestQueue second;
+    riot::WatchableSemaphore sema(0);
+    int firstOut = 0;
+    int secondOut = 0;
+    if (sel.wait() != -EINVAL || sel.add(first, firstOut) != 0 || sel.add(second, secondOut) != 1 ||
+        sel.add(sema) != 2 || sel.add(sema) != -ENOMEM || sel.size() != 3 || sel.tryWait() != -EAGAIN) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sel.wait() != -EINVAL || sel.add(first, firstOut) != 0 || ... || sel.tryWait() != -EAGAIN)\n");
+        failedTests += 1;
+        return;
+    }
+    uint64_t start = xtimer_now_usec64();
+    if (sel.waitTimed(2000) != -ETIMEDOUT || xtimer_now_usec64() - start < 2000) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sel.waitTimed(2000) != -ETIMEDOUT || xtimer_now_usec64() - start < 2000)\n");
+        failedTests += 1;
+        return;
+    }
+    second.add(7);
+    sema.post();
+    if (sel.wait() != 1 || secondOut != 7 || !second.empty() || sel.waitTimed(2000) != 2 ||
+        sema.tryWait() != -EAGAIN || sel.tryWait() != -EAGAIN) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sel.wait() != 1 || secondOut != 7 || ... || sel.tryWait() != -EAGAIN)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test fairness. Expected behavior: With all sources ready, the sources are
+// selected round-robin and each queue is drained in FIFO order.
+auto selectorTestRoundRobin(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Selector<2> sel;
+    SelectorTestQueue first;
+    SelectorTestQueue second;
+    int firstOut = 0;
+    int secondOut = 0;
+    sel.add(first, firstOut);
+    sel.add(second, secondOut);
+    for (int i = 0; i < 3; ++i) {
+        first.add(i);
+        second.add(10 + i);
+    }
+    for (int i = 0; i < 3; ++i) {
+        if (sel.wait() != 0 || firstOut != i || sel.wait() != 1 || secondOut != 10 + i) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (sel.wait() != 0 || firstOut != i || sel.wait() != 1 || secondOut != 10 + i)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    second.add(20);
+    if (sel.wait() != 1 || secondOut != 20 || sel.tryWait() != -EAGAIN) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (sel.wait() != 1 || secondOut != 20 || sel.tryWait() != -EAGAIN)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Sources fed by selectorTestFeeder.
+class SelectorTestFeed
+{
+public:
+    SelectorTestQueue * queue;
+    riot::WatchableSemaphore * sema;
+};
+
+static char selectorTestStack[THREAD_STACKSIZE_DEFAULT];
+
+// Runs with lower priority than the owner. Feeds the sources while the
+// owner is blocked in the wait operations.
+auto selectorTestFeeder(void * arg) -> void *
+{
+    SelectorTestFeed * feed = static_cast<SelectorTestFeed *>(arg);
+    xtimer_usleep(1000);
+    feed->queue->add(5);
+    xtimer_usleep(1000);
+    feed->sema->post();
+    return nullptr;
+}
+
+// Test wake-up: Expected behavior: The owner blocked in wait() and
+// waitTimed() is woken by another thread adding to a queue or posting a
+// semaphore.
+auto selectorTestWakeUp(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::Selector<2> sel;
+    SelectorTestQueue queue;
+    riot::WatchableSemaphore sema(0);
+    int out = 0;
+    sel.add(queue, out);
+    sel.add(sema);
+    SelectorTestFeed feed = {&queue, &sema};
+    uint64_t start = xtimer_now_usec64();
+    kernel_pid_t pid = thread_create(selectorTestStack, sizeof(selectorTestStack),
+                                     THREAD_PRIORITY_MAIN + 1, THREAD_CREATE_STACKTEST,
+                                     selectorTestFeeder, &feed, "selector feeder");
+    int first = sel.wait();
+    int second = sel.waitTimed(1000000);
+    uint64_t elapsed = xtimer_now_usec64() - start;
+    while (thread_getstatus(pid) != STATUS_NOT_FOUND) {
+        xtimer_usleep(100);
+    }
+    if (first != 0 || out != 5 || second != 1 || elapsed < 2000 || elapsed >= 1000000 ||
+        sel.tryWait() != -EAGAIN) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (first != 0 || out != 5 || second != 1 || ... || sel.tryWait() != -EAGAIN)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all Selector Tests
+auto runSelectorTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    selectorTestWait(succeededTests, failedTests);
+    selectorTestRoundRobin(succeededTests, failedTests);
+    selectorTestWakeUp(succeededTests, failedTests);
+}
+
+#endif // SELECTOR_TESTS_HPP
@@ -12,10 +12,27 @@
 #include "mutex/lock_tests.hpp"
 #include "iterator/iterator_tests.hpp"
 #include "array/array_tests.hpp"
+#include "array/soaarray_tests.hpp"
 #include "ringbuffer/ringbuffer_tests.hpp"
 #include "ringbuffer/lockedringbuffer_tests.hpp"
 #include "ringbuffer/blockingringbuffer_tests.hpp"
 #include "semaphore/semaphore_tests.hpp"
+#include "hashmap/statichashmap_tests.hpp"
+#include "priorityqueue/priorityqueue_tests.hpp"
+#include "timerwheel/timerwheel_tests.hpp"
+#include "bitset/bitset_tests.hpp"
+#include "bench/benchsuite_tests.hpp"
+#include "histogram/histogram_tests.hpp"
+#include "ringbuffer/recordringbuffer_tests.hpp"
+#include "ringbuffer/bipbuffer_tests.hpp"
+#include "triplebuffer/triplebuffer_tests.hpp"
+#include "ringbuffer/broadcastringbuffer_tests.hpp"
+#include "ringbuffer/priorityblockingringbuffer_tests.hpp"
+#include "ringbuffer/windowedringbuffer_tests.hpp"
+#include "selector/selector_tests.hpp"
+#if defined(__cpp_impl_coroutine)
+#include "coroutine/coroutine_tests.hpp"
+#endif
 
 // Run all Tests.
 auto runAllTests() -> void
@@ -28,10 +45,27 @@ auto runAllTests() -> void
     runLockTests(succeededTests, failedTests);
     runIteratorTests(succeededTests, failedTests);
     runArrayTests(succeededTests, failedTests);
+    runSoAArrayTests(succeededTests, failedTests);
     runRingbufferTests(succeededTests, failedTests);
     runLockedRingbufferTests(succeededTests, failedTests);
     runBlockingRingbufferTests(succeededTests, failedTests);
     runSemaphoreTests(succeededTests, failedTests);
+    runStaticHashMapTests(succeededTests, failedTests);
+    runPriorityQueueTests(succeededTests, failedTests);
+    runTimerWheelTests(succeededTests, failedTests);
+    runBitsetTests(succeededTests, failedTests);
+    runBenchSuiteTests(succeededTests, failedTests);
+    runHistogramTests(succeededTests, failedTests);
+    runRecordRingbufferTests(succeededTests, failedTests);
+    runBipBufferTests(succeededTests, failedTests);
+    runTripleBufferTests(succeededTests, failedTests);
+    runBroadcastRingbufferTests(succeededTests, failedTests);
+    runPriorityBlockingRingbufferTests(succeededTests, failedTests);
+    runWindowedRingbufferTests(succeededTests, failedTests);
+    runSelectorTests(succeededTests, failedTests);
+#if defined(__cpp_impl_coroutine)
+    runCoroutineTests(succeededTests, failedTests);
+#endif
 
     printf("\n--- Testrun finished ---\n\n");
     printf("Tests ran: %u\n", succeededTests + failedTests);
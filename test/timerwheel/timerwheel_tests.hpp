@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef TIMERWHEEL_TESTS_HPP
+#define TIMERWHEEL_TESTS_HPP
+
+#include "riot/timerwheel.hpp"
+
+// Expiry callback: Stores the current tick of the wheel in the argument.
+class TimerWheelTestRecord
+{
+public:
+    TimerWheelTestRecord(riot::TimerWheel<2, 3> & wheel)
+        : wheel(wheel)
+        , firedAt(0)
+        , timesFired(0)
+    {
+    }
+
+    static auto callback(void * arg) -> void
+    {
+        TimerWheelTestRecord * rec = static_cast<TimerWheelTestRecord *>(arg);
+        rec->firedAt = rec->wheel.now();
+        rec->timesFired += 1;
+    }
+
+    riot::TimerWheel<2, 3> & wheel;
+    uint32_t firedAt;
+    uint32_t timesFired;
+};
+
+// Test schedule(). Expected behavoir: A timer fires exactly once, on the
+// tick it was scheduled for. Covers all levels and cascading between them.
+auto timerWheelTestSchedule(size_t& succeededTests, size_t& failedTests) -> void
+{
+    uint32_t delays[6] = {1, 3, 4, 17, 40, 63};
+    for (size_t i = 0; i < 6; ++i) {
+        riot::TimerWheel<2, 3> wheel;
+        wheel.advance(5);
+        TimerWheelTestRecord rec(wheel);
+        riot::WheelTimer timer(TimerWheelTestRecord::callback, &rec);
+        wheel.schedule(timer, delays[i]);
+        wheel.advance(70);
+        if (rec.timesFired != 1 || rec.firedAt != 5 + delays[i]) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (rec.timesFired != 1 || rec.firedAt != 5 + delays[i])\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    // Delay exceeding the wheels range is rejected.
+    riot::TimerWheel<2, 3> wheel;
+    riot::WheelTimer timer(TimerWheelTestRecord::callback, nullptr);
+    if (wheel.schedule(timer, wheel.maxDelay() + 1) != -EINVAL || timer.scheduled()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (wheel.schedule(timer, wheel.maxDelay() + 1) != -EINVAL || timer.scheduled())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test cancel(). Expected behavoir: A cancelled timer never fires.
+// Cancelling an idle timer returns -ENOENT.
+auto timerWheelTestCancel(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::TimerWheel<2, 3> wheel;
+    TimerWheelTestRecord rec(wheel);
+    riot::WheelTimer timer1(TimerWheelTestRecord::callback, &rec);
+    riot::WheelTimer timer2(TimerWheelTestRecord::callback, &rec);
+    wheel.schedule(timer1, 20);
+    wheel.schedule(timer2, 20);
+    if (wheel.cancel(timer1) != 0 || wheel.cancel(timer1) != -ENOENT) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (wheel.cancel(timer1) != 0 || wheel.cancel(timer1) != -ENOENT)\n");
+        failedTests += 1;
+        return;
+    }
+    wheel.advance(30);
+    if (rec.timesFired != 1 || timer2.scheduled()) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rec.timesFired != 1 || timer2.scheduled())\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test remaining(). Expected behavoir: Number of ticks until expiry.
+auto timerWheelTestRemaining(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::TimerWheel<2, 3> wheel;
+    riot::WheelTimer timer(TimerWheelTestRecord::callback, nullptr);
+    if (wheel.remaining(timer) != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (wheel.remaining(timer) != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    wheel.schedule(timer, 30);
+    wheel.advance(12);
+    if (wheel.remaining(timer) != 18 || timer.expiry() != 30) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (wheel.remaining(timer) != 18 || timer.expiry() != 30)\n");
+        failedTests += 1;
+        return;
+    }
+    wheel.cancel(timer);
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test advanceTo(). Expected behavoir: Timers expire while advancing to an
+// absolute tick, also across wrap around of the tick counter.
+auto timerWheelTestAdvanceTo(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::TimerWheel<2, 3> wheel;
+    TimerWheelTestRecord rec(wheel);
+    riot::WheelTimer timer(TimerWheelTestRecord::callback, &rec);
+    wheel.schedule(timer, 10);
+    wheel.advanceTo(9);
+    if (rec.timesFired != 0) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rec.timesFired != 0)\n");
+        failedTests += 1;
+        return;
+    }
+    wheel.advanceTo(10);
+    if (rec.timesFired != 1 || wheel.now() != 10) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rec.timesFired != 1 || wheel.now() != 10)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Periodic timer: Reschedules itself from its own callback.
+class TimerWheelTestPeriodic
+{
+public:
+    TimerWheelTestPeriodic(riot::TimerWheel<2, 3> & wheel)
+        : wheel(wheel)
+        , timer(callback, this)
+        , timesFired(0)
+    {
+    }
+
+    static auto callback(void * arg) -> void
+    {
+        TimerWheelTestPeriodic * p = static_cast<TimerWheelTestPeriodic *>(arg);
+        p->timesFired += 1;
+        p->wheel.schedule(p->timer, 4);
+    }
+
+    riot::TimerWheel<2, 3> & wheel;
+    riot::WheelTimer timer;
+    uint32_t timesFired;
+};
+
+// Test batch delivery. Expected behavoir: All timers expiring on the same tick
+// fire on this tick. Rescheduling from a callback is allowed.
+auto timerWheelTestBatch(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::TimerWheel<2, 3> wheel;
+    TimerWheelTestRecord rec(wheel);
+    riot::WheelTimer timer1(TimerWheelTestRecord::callback, &rec);
+    riot::WheelTimer timer2(TimerWheelTestRecord::callback, &rec);
+    riot::WheelTimer timer3(TimerWheelTestRecord::callback, &rec);
+    wheel.schedule(timer1, 7);
+    wheel.schedule(timer2, 7);
+    wheel.schedule(timer3, 7);
+    wheel.advance(7);
+    if (rec.timesFired != 3) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (rec.timesFired != 3)\n");
+        failedTests += 1;
+        return;
+    }
+    TimerWheelTestPeriodic periodic(wheel);
+    wheel.schedule(periodic.timer, 4);
+    wheel.advance(40);
+    wheel.cancel(periodic.timer);
+    if (periodic.timesFired != 10) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (periodic.timesFired != 10)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all TimerWheel Tests
+auto runTimerWheelTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    timerWheelTestSchedule(succeededTests, failedTests);
+    timerWheelTestCancel(succeededTests, failedTests);
+    timerWheelTestRemaining(succeededTests, failedTests);
+    timerWheelTestAdvanceTo(succeededTests, failedTests);
+    timerWheelTestBatch(succeededTests, failedTests);
+}
+
+#endif // TIMERWHEEL_TESTS_HPP
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2017 Simon Brummer <simon.brummer@posteo.de>
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#ifndef TRIPLEBUFFER_TESTS_HPP
+#define TRIPLEBUFFER_TESTS_HPP
+
+#include "../testobj.hpp"
+#include "riot/triplebuffer.hpp"
+
+// Test write() and read(). Expected behavior: Reader gets the latest
+// published value once, older unread values are dropped.
+auto tripleBufferTestWriteRead(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::TripleBuffer<TestObj> tbuf(TestObj(0,0,0));
+    TestObj out;
+    if (tbuf.fresh() || tbuf.read(out) != -EAGAIN || out != TestObj(0,0,0)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (tbuf.fresh() || tbuf.read(out) != -EAGAIN || out != TestObj(0,0,0))\n");
+        failedTests += 1;
+        return;
+    }
+    tbuf.write(TestObj(1,2,3));
+    tbuf.write(TestObj(4,5,6));
+    if (!tbuf.fresh() || tbuf.read(out) != 0 || out != TestObj(4,5,6) ||
+        tbuf.read(out) != -EAGAIN || out != TestObj(4,5,6)) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (!tbuf.fresh() || tbuf.read(out) != 0 || out != TestObj(4,5,6) || tbuf.read(out) != -EAGAIN || ...)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Test back(), publish(), update() and front(). Expected behavior: Values are
+// filled and read in place. front() is stable while the writer continues.
+auto tripleBufferTestInPlace(size_t& succeededTests, size_t& failedTests) -> void
+{
+    riot::TripleBuffer<uint32_t> tbuf;
+    for (uint32_t i = 1; i <= 10; ++i) {
+        tbuf.back() = i;
+        tbuf.publish();
+        if (i == 5 && (tbuf.update() != 0 || tbuf.front() != 5)) {
+            printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+            printf("!--- Reason: (tbuf.update() != 0 || tbuf.front() != 5)\n");
+            failedTests += 1;
+            return;
+        }
+    }
+    uint32_t const & front = tbuf.front();
+    if (front != 5 || tbuf.update() != 0 || tbuf.front() != 10 || tbuf.update() != -EAGAIN) {
+        printf("Test '%s' failed.\n", __PRETTY_FUNCTION__);
+        printf("!--- Reason: (front != 5 || tbuf.update() != 0 || tbuf.front() != 10 || tbuf.update() != -EAGAIN)\n");
+        failedTests += 1;
+        return;
+    }
+    printf("Test '%s' succeeded.\n", __PRETTY_FUNCTION__);
+    succeededTests += 1;
+}
+
+// Run all TripleBuffer Tests
+auto runTripleBufferTests(size_t& succeededTests, size_t& failedTests) -> void
+{
+    tripleBufferTestWriteRead(succeededTests, failedTests);
+    tripleBufferTestInPlace(succeededTests, failedTests);
+}
+
+#endif // TRIPLEBUFFER_TESTS_HPP